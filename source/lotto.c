@@ -1,5 +1,5 @@
 /**
- * Turkey Sayisal and Super Lotto Statistics and Ball Draw Algorithms
+ * Turkey Sayisal, Super and American PowerBall Lotto Statistics and Ball Draw Algorithms
  * Author: İbrahim Tıpırdamaz  <itipirdamaz@gmail.com>
  * Copyright 2022
 */
@@ -11,17 +11,21 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <sys/stat.h>
 
 #if defined(__linux__) || defined(__unix__) || defined(__APPLE__) || defined(SOLARIS) || defined(WIN32)
 #include <libgen.h>
 #include <unistd.h>
 #endif
 
-
-
-// If you want to compile for sayisal lotto, you must #define SAYISALLOTTO at following line. Otherwise it will be compiled for super lotto.
-
-//#define SAYISALLOTTO 1
+#if defined(__linux__) || defined(__unix__) || defined(__APPLE__) || defined(SOLARIS)
+#define USE_THREADS 1				// worker threads (pthreads) are used, otherwise the work runs on the main thread
+#define USE_MMAP 1					// files are memory mapped (mmap), otherwise they are read into memory
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
 
 
 
@@ -50,19 +54,71 @@ CoreFoundation to link line */
 #endif
 
 
-#ifdef SAYISALLOTTO
-	#define TOTAL_BALL 90			// total ball count
-	#define TOTAL_BALL_SS 90		// total super star ball count
-	#define FILESTATS "sayisal.txt"	// statistics file (winning numbers, superstar numbers)
+#define GAME_SAYISAL 0				// games (index in games, --game NAME)
+#define GAME_SUPER 1
+#define GAME_POWERBALL 2
+#define GAME_COUNT 3
+#define DATE_DMY 0					// date format of the statistics file: dd.mm.yyyy
+#define DATE_MDY 1					// date format of the statistics file: mm/dd/yyyy
+
+#define MAX_TOTAL_BALL 90			// largest total ball count of the games (size of the ball arrays)
+#define MAX_DRAW_BALL 6				// largest number of balls drawn by the games (size of the row arrays)
+#define TOTAL_BALL (game.totalBall)				// total ball count of the game
+#define DRAW_BALL (game.drawBall)				// number of balls to be drawn
+#define TOTAL_BALL_BONUS (game.totalBallBonus)	// total bonus ball count (SuperStar, PowerBall), 0 if the game has no bonus ball
+#define MIN_LUCKY (numberOfTerm(ceil(180/TOTAL_BALL)+1)+1)	// draws of a lucky double combination of the lucky draws (drawBallsByLucky)
+
+#ifdef __MSDOS__
+#define FILESTATS_PB "powerbll.txt"	// statistics file of the powerball (winning numbers, powerball numbers)
 #else
-	#define TOTAL_BALL 60			// total ball count
-	#define TOTAL_BALL_SS 0			// total super star ball count
-	#define FILESTATS "super.txt"   // statistics file (winning numbers)
+#define FILESTATS_PB "powerball.txt"	// statistics file of the powerball (winning numbers, powerball numbers)
 #endif
 
-
 #define OUTPUTFILE "output.txt"     // file to write results
-#define DRAW_BALL 6					// number of balls to be drawn
+#define CACHE_EXT ".dat"			// extension of the binary history cache (next to the statistics file, in place of its extension)
+#define CACHE_MAGIC "LBHC"			// first bytes of the binary history cache
+#define CACHE_VERSION 2				// layout of the binary history cache (written caches of other versions are parsed again)
+#define TEMP_EXT ".tmp"				// extension of the statistics file while add-draw writes it again
+#define MAX_THREADS 64				// maximum number of worker threads
+#define RNG_XOSHIRO 0				// random number generator: xoshiro128** (state per thread, jump-ahead for independent streams)
+#define RNG_LIBC 1					// random number generator: libc rand() (shared state, the sequence of the earlier versions)
+#define GAUSS_RIGHT 0.505			// probability of the ball falling to the right at a node of the pascal's triangle (gaussIndex)
+#define SELF_TEST_SAMPLES 400000	// samples of each gaussIndex sampler per ball count (--self-test)
+#define SHUFFLE_BATCH 256			// number of random indexes generated at a time by the globe shuffle (mixGlobe)
+#define GLOBE_LEFT 0				// globe layout: balls stacked to the left in the order of ballStats
+#define GLOBE_BLEND1 1				// globe layout: ballStats divided in the middle, the left and right parts inverted and combined
+#define GLOBE_BLEND2 2				// globe layout: balls taken from the left and right of ballStats, placed from the middle to the edges
+#define GLOBE_SIDE 3				// globe layout: balls of ballStats placed alternately at the right and left edges
+#define ARENA_BLOCK 65536			// size of an arena memory block (bytes)
+#define ARENA_ALIGN 16				// alignment of the arena allocations (bytes)
+#define BATCH_CHUNK 50				// coupons drawn and written at a time by the batch mode (the rows of a chunk are checked against each other)
+#define BATCH_ROUND 20				// chunks drawn by a worker thread of the batch mode before the chunks are written
+#define BATCH_WINDOW 8192			// rows of a generation of the batch dedup window (the rows of the last 2 generations are not written again)
+#define BATCH_YIELD 20				// a round of the batch writing less than 1/BATCH_YIELD of its rows gives few new rows
+#define BATCH_RETRY 10				// rounds of the batch in a row giving few new rows before it stops (the strategies are exhausted)
+#define STRATEGY_DATE 1				// draw strategies of the batch mode (--strategy), bit flags
+#define STRATEGY_NORM 2
+#define STRATEGY_LEFT 4
+#define STRATEGY_BLEND1 8
+#define STRATEGY_BLEND2 16
+#define STRATEGY_SIDE 32
+#define STRATEGY_RAND 64
+#define STRATEGY_LUCKY 128
+#define STRATEGY_ALL 255
+#define COMMAND_STATS 1				// commands of the command line (run one operation, write its results and exit)
+#define COMMAND_DRAW 2
+#define COMMAND_MATCH 3
+#define COMMAND_LUCKY 4
+#define COMMAND_ADD 5				// add-draw: add a draw to the top of the statistics file, update the statistics and the cache
+
+#define FILTER_BITS_COMB 4			// combinations up to this size are kept in bitsets by rank in the combination filter, larger ones in hash sets
+#define COUPON_BITS_COMB 2			// the same for the combination filters of the coupons (diversity rules)
+#define MAX_COMB_RANKS 20			// most combinations of the same size of MAX_DRAW_BALL keys, C(MAX_DRAW_BALL, MAX_DRAW_BALL/2)
+#define BLOOM_BITS_PER_KEY 10		// bits of a Bloom filter per combination of the drawn balls history (--bloom)
+#define BLOOM_HASHES 4				// bits set per combination in a word of a Bloom filter
+
+#define MASK_WORD_BITS (sizeof(unsigned long)*8)							// bits in a word of the ball bitmask
+#define MASK_WORDS ((int) ((MAX_TOTAL_BALL + MASK_WORD_BITS - 1) / MASK_WORD_BITS))	// words in the ball bitmask
 
 
 
@@ -71,8 +127,63 @@ CoreFoundation to link line */
 
 /* current working directory */
 char *cwd = NULL;
-char *fileStats = NULL;		// cwd + PATH_SEPARATOR + FILESTATS
+char *fileStats = NULL;		// cwd + PATH_SEPARATOR + game.fileStats
 char *outputFile = NULL;	// cwd + PATH_SEPARATOR + OUTPUTFILE
+char *fileCache = NULL;		// fileStats with CACHE_EXT
+
+/* number of worker threads (--threads N) */
+int threadCount = 1;
+
+/* random number generator of the main thread (--rng NAME, --seed N) */
+int rngType = RNG_XOSHIRO;
+unsigned long rngSeed = 0;
+
+/* Bloom filters in front of the combination filter (--bloom) */
+int useBloom = 0;
+
+/* binary history cache of the statistics file (--no-cache: always parse the statistics file) */
+int useCache = 1;
+
+/* check the gaussIndex samplers and exit (--self-test) */
+int selfTest = 0;
+
+/* batch coupon generation (--batch N, --strategy LIST), 0: interactive menu */
+long batchCount = 0;
+int batchStrategy = STRATEGY_ALL;
+int batchUnique = 0;	// --unique: a row is written once in the batch, not only once in the dedup window
+
+/* command of the command line (stats, draw --count N, match --k N, lucky --k N, -o FILE), 0: interactive menu */
+int command = 0;
+int commandK = 2;
+int commandCount = 1;
+char commandRow[256] = "";	// row of add-draw, the date and the numbers separated with tabs
+char *commandOutput = NULL;	// output file of the command or of the batch (NULL: stdout, output.txt for the batch)
+
+/* print the time of the initialization and of the command to stderr (--time) */
+int printTime = 0;
+
+/* print the results to the screen too (0 for the commands, they write the results to their output only) */
+int printScreen = 1;
+
+/* draw session arena (drawn balls, coupon rows), released after the coupon is printed */
+struct Arena *drawArena = NULL;
+
+
+
+struct Game {			/* Game descriptor (balls, statistics file and date format of a game) */
+	char *name;				// name of the game (--game NAME)
+	char *title;			// title of the main menu
+	int totalBall;			// total ball count
+	int drawBall;			// number of balls to be drawn (at most MAX_DRAW_BALL)
+	int totalBallBonus;		// total bonus ball count, 0 if the game has no bonus ball
+	char *bonusName;		// bonus balls in the title of their statistics (NULL if the game has no bonus ball)
+	char *bonusLabel;		// label of the drawn bonus balls
+	char *couponHeader;		// header of the coupon
+	char *fileStats;		// statistics file (winning numbers, bonus numbers)
+	int dateFormat;			// date format of the statistics file and of the results (DATE_DMY or DATE_MDY)
+	int extraColumns;		// columns after the winning numbers in the statistics file
+	int bonusColumn;		// column of the bonus ball after the winning numbers (1..extraColumns, 0 if there is none)
+};
 
 
 
@@ -90,23 +201,207 @@ struct ListX {			/* List (globe, drawn balls, statistics file row etc) */
 	int val;            // how many times the numbers that love each other drawn together (for lucky numbers)
 	struct Item *head;  // first item in the list
 	struct ListX *next; // next list (next row, if two dimensions)
+	struct Arena *arena; // arena the list and its items are allocated from (NULL if they are allocated with malloc)
 };
 
 
 
 struct ListXY {			/* 2 dimensions List. Multi draw (coupon or drawn balls from file has been drawn so far) */
 	struct ListX *list; // list
+	struct ListX *tail; // last list
+	struct ListX **index; // lists by index (random access to the lists)
+	int length;         // number of lists
+	int size;           // number of allocated index entries
+	struct CombFilter *filter; // combinations of the lists (for the coupon diversity rules, NULL if not used)
+};
+
+
+
+struct Globe {			/* Globe of a draw (balls in a fixed array, in the order they are placed in the globe) */
+	int balls[MAX_TOTAL_BALL];	// ball numbers (index 0 is the left edge of the globe)
+	int count;				// ball count in the globe
+};
+
+
+
+struct Rng {			/* Random number generator (every thread uses its own) */
+	int type;				// RNG_XOSHIRO or RNG_LIBC
+	unsigned int s[4];		// xoshiro128** state
+};
+
+
+
+struct GaussTable {		/* Alias table of the gaussIndex distribution for a ball count (1 + binomial(ballCount-1, GAUSS_RIGHT)) */
+	unsigned int prob[MAX_TOTAL_BALL];	// probability of keeping the column (scaled to 2^32)
+	int alias[MAX_TOTAL_BALL];			// index taken if the column is not kept
+	double weight[MAX_TOTAL_BALL];		// probability of the index (binomial, for the draws without replacement)
+};
+
+
+
+struct ArenaBlock {		/* Memory block of an arena (the allocations follow the header) */
+	struct ArenaBlock *next;	// previous block
+	size_t size;				// size of the block (bytes, header included)
+	size_t used;				// used bytes (header included)
+};
+
+
+
+struct Arena {			/* Memory region the lists and items of a draw session are allocated from, released in one call */
+	struct ArenaBlock *block;	// current block (blocks are linked)
+	struct Item *freeItems;		// items returned to the arena (reused before allocating new ones)
+	struct ListX *freeLists;	// lists returned to the arena (reused before allocating new ones)
+};
+
+
+
+struct BallMask {		/* Ball bitmask of a draw (bit n-1 is set if the ball n is in the draw) */
+	unsigned long bits[MASK_WORDS];
+};
+
+
+
+struct DrawHistory {	/* Drawn balls from file has been drawn so far (packed, one fixed width row per draw) */
+	int count;							// number of draws (rows)
+	int size;							// number of allocated rows
+	unsigned char (*balls)[MAX_DRAW_BALL];	// winning numbers of the draws (DRAW_BALL numbers, the rest of the row is 0)
+	struct BallMask *mask;				// ball bitmask of the winning numbers of the draws
+	unsigned char *bonusBall;			// bonus number of the draws (SuperStar, PowerBall, 0 if the game has no bonus ball)
+	long *date;							// drawn date of the draws (yyyymmdd)
+};
+
+
+
+struct CombCount {		/* Occurrence of a ball combination in the drawn balls history */
+	int count;			// number of draws containing the combination
+	int first;			// index of the first draw containing the combination
+	int second;			// index of the second draw containing the combination
+};
+
+
+
+struct BloomFilter {		/* Bloom filter of combinations (no false negatives, a word per combination) */
+	unsigned long *bits;		// bitset
+	unsigned long words;		// number of words of the bitset (power of 2)
+	unsigned long queries;		// number of lookups
+	unsigned long hits;			// number of lookups passed (combination may be in the set)
+	unsigned long falseHits;	// number of lookups passed but the combination is not in the set
+};
+
+
+
+struct CombFilter {		/* Combinations of the drawn balls history or of a coupon (has the combination ever been drawn?) */
+	int bitsComb;								// combinations up to bitsComb keys are in the bitsets, the larger ones in the hash sets
+	unsigned long *bits[FILTER_BITS_COMB+1];	// bitsets of the single, double, triple and quartet combinations by rank (bits[comb])
+	unsigned long *keys[MAX_DRAW_BALL+1];			// hash sets of the larger combinations (rank+1, 0 if the slot is empty)
+	int used[MAX_DRAW_BALL+1];						// number of combinations in the hash sets
+	int size[MAX_DRAW_BALL+1];						// number of slots of the hash sets (power of 2)
+	struct BloomFilter *bloom[MAX_DRAW_BALL+1];		// Bloom filters in front of the bitsets and hash sets (NULL if not used)
+};
+
+
+
+struct MatchCombWork {	/* Work of a thread comparing the draws with each other (rows first..last-1 of the triangular loop) */
+	int first;							// first draw (row)
+	int last;							// last draw (row), exclusive
+	unsigned int match[MAX_DRAW_BALL+1];	// match[n]: number of draw pairs having at least n balls in common
+};
+
+
+
+struct LuckyEntry {		/* Lucky numbers entry (a combination drawn in at least 2 draws) */
+	unsigned long key;	// packed combination
+	struct CombCount cc;	// occurrence of the combination
+};
+
+
+
+struct LuckyWork {		/* Work of a thread counting or collecting the lucky numbers (combinations ranked first..last-1) */
+	int comb;						// double, triple or quartet (2, 3 or 4) combinations
+	long first;						// first rank
+	long last;						// last rank, exclusive
+	int firstRow;					// first draw (row) ranked by the thread
+	int lastRow;					// last draw (row) ranked by the thread, exclusive
+	long *ranks;					// ranks of the combinations of the draws, C(DRAW_BALL, comb) per draw (shared, every thread writes its own rows)
+	struct CombCount *counts;		// occurrences of the combinations by rank (shared, every thread writes its own ranks)
+	struct LuckyEntry *entries;		// lucky numbers found in the ranks of the thread (partial table)
+	int count;						// number of entries
+};
+
+
+
+struct LuckyIndex {		/* Co-occurrence index of the drawn balls history (numbers that love each other drawn together) */
+	struct CombCount *counts[5];	// occurrences of the double, triple and quartet combinations by rank (counts[comb], NULL if not counted)
+};
+
+
+
+struct HistoryCache {	/* Header of the binary history cache (followed by the days, the winning numbers and the bonus numbers of the draws) */
+	char magic[4];			// CACHE_MAGIC
+	int version;			// CACHE_VERSION
+	int game;				// game of the statistics file (index in games)
+	int drawBall;			// winning numbers per draw (MAX_DRAW_BALL bytes per row, the rest of the row is 0)
+	long count;				// number of draws
+	long sourceSize;		// size of the statistics file the cache was written from
+	long sourceTime;		// modification time of the statistics file the cache was written from
+	unsigned int match[MAX_DRAW_BALL+1];	// matched combination counts of the draws (match2comb, match3comb, ..)
+};
+
+
+
+struct DrawWork {		/* Work of a thread drawing the coupons of the batch mode (chunks of BATCH_CHUNK rows) */
+	struct Rng rng;							// random number generator of the thread (mainRng jumped ahead)
+	struct Arena *arena;					// drawn balls and coupon rows of the thread (released after the chunks are written)
+	struct ListX *ballStats;				// copy of winningBallStats (the draws sort it)
+	struct ListX *ballStatsBonus;			// copy of bonusBallStats (NULL if the game has no bonus ball)
+	struct ListXY *coupons[BATCH_ROUND];	// chunks drawn by the thread
+	struct ListXY *couponsBonus[BATCH_ROUND];	// bonus balls of the chunks (SuperStar, PowerBall)
+	int rows[BATCH_ROUND];					// number of rows of the chunks
+	int count;								// number of chunks
+	int strategies[BATCH_ROUND];			// draw strategies of the chunks (STRATEGY_DATE | STRATEGY_NORM | ...)
+};
+
+
+
+/* Games and the game being played (--game NAME, a copy of its entry) */
+struct Game games[GAME_COUNT] = {
+	{"sayisal", "Sayisal Lotto 1.0", 90, 6, 90, "SuperStar balls", "super star", "     Numbers          SuperStar", "sayisal.txt", DATE_DMY, 2, 2},
+	{"super", "Super Lotto 1.0", 60, 6, 0, NULL, NULL, "     Numbers", "super.txt", DATE_DMY, 0, 0},
+	{"powerball", "PowerBall Lotto 1.0", 69, 5, 26, "PowerBalls", "power ball", "     Numbers       PowerBall", FILESTATS_PB, DATE_MDY, 1, 1}
 };
 
+struct Game game;
+
+/* Random number generator of the main thread (seeded in main with rngType, rngSeed) */
+struct Rng mainRng;
+
+/* Drawn balls from file has been drawn so far */
+struct DrawHistory *drawHistory = NULL;
+
+/* Co-occurrence index of the drawn balls history (built once at load) */
+struct LuckyIndex *luckyIndex = NULL;
+
+/* Combinations of the drawn balls history (matchComb/elimComb rules of the draws) */
+struct CombFilter *combFilter = NULL;
+
+/* Lucky numbers lists of the lucky draws (drawBallsByLucky), built on first use (initLuckyDraw) */
+struct ListXY *luckyDraw2 = NULL;
+struct ListXY *luckyDraw2Sorted = NULL;
+struct ListXY *luckyDraw3Sorted = NULL;
+
+/* Lucky partners of the balls, the balls drawn together with a ball in at least MIN_LUCKY draws (built by initLuckyDraw) */
+unsigned char luckyPartners[MAX_TOTAL_BALL+1][MAX_TOTAL_BALL];
+int luckyPartnerCount[MAX_TOTAL_BALL+1];
 
+/* Binomial coefficients C(n, k) for n = 0..TOTAL_BALL, k = 0..DRAW_BALL (combinadic ranks of the combinations, built in init) */
+long binomTable[MAX_TOTAL_BALL+1][MAX_DRAW_BALL+1];
 
-/* Drawn balls lists from file has been drawn so far */
-struct ListXY *winningDrawnBallsList = NULL;
-struct ListXY *superStarDrawnBallsList = NULL;
+/* Alias tables of gaussIndex by ball count (1..TOTAL_BALL, built in init) */
+struct GaussTable gaussTable[MAX_TOTAL_BALL+1];
 
 /* How many times were the winning numbers drawn in the previous draws? */
 struct ListX *winningBallStats = NULL;
-struct ListX *superStarBallStats = NULL;
+struct ListX *bonusBallStats = NULL;
 
 
 /* Matched combinations of numbers from previous draws */
@@ -169,6 +464,90 @@ struct ListX *createListX(struct ListX *pl, char *date, char *label, int val);
 
 
 
+/**
+ * Create Empty List (1 dimension) in the arena. The list and its items are allocated from the arena.
+ * 
+ * @param {struct Arena *} pa : refers to an arena (if NULL, the list is allocated with malloc like createListX)
+ * @param {char *} date       : old drawn date (for statistics file rows, otherwise NULL)
+ * @param {char *} label      : list label (for new drawns lists, otherwise NULL)
+ * @param {Integer} val       : how many times the numbers that love each other drawn together (for lucky numbers list)
+ * 
+ * @return {struct ListX *}   : refers to the ball list
+ */
+struct ListX *createListXIn(struct Arena *pa, char *date, char *label, int val);
+
+
+
+/**
+ * Copy the list (keys and values of the items). The copy is allocated with malloc.
+ * 
+ * @param {struct ListX *} pl : refers to a ball list
+ * @return {struct ListX *}   : refers to the copy of the ball list
+ */
+struct ListX *copyListX(struct ListX *pl);
+
+
+
+/**
+ * Create Empty Arena
+ * 
+ * @param {struct Arena *} pa : refers to an arena
+ * @return {struct Arena *}   : refers to the arena (memory allocated)
+ */
+struct Arena *createArena(struct Arena *pa);
+
+
+
+/**
+ * Allocate memory from the arena
+ * 
+ * @param {struct Arena *} pa : refers to an arena
+ * @param {size_t} size       : size of the memory (bytes)
+ * @return {void *}           : refers to the memory (aligned to ARENA_ALIGN)
+ */
+void *arenaAlloc(struct Arena *pa, size_t size);
+
+
+
+/**
+ * Release all the memory allocated from the arena in one call. The lists and items allocated from the arena must not be used any more.
+ * 
+ * @param {struct Arena *} pa : refers to an arena
+ */
+void releaseArena(struct Arena *pa);
+
+
+
+/**
+ * Returns a new item (ball) for the list, from the arena of the list (or malloc)
+ * 
+ * @param {struct ListX *} pl : refers to a ball list
+ * @param {Integer} key       : key (ball number)
+ * @return {struct Item *}    : refers to the item
+ */
+struct Item *newItem(struct ListX *pl, int key);
+
+
+
+/**
+ * Free an item (ball) of the list, returns it to the arena of the list (or free)
+ * 
+ * @param {struct ListX *} pl : refers to a ball list
+ * @param {struct Item *} pt  : refers to the item
+ */
+void freeItem(struct ListX *pl, struct Item *pt);
+
+
+
+/**
+ * Remove all items in the list and free the list
+ * 
+ * @param {struct ListX *} pl : refers to a ball list
+ */
+void freeListX(struct ListX *pl);
+
+
+
 /** 
  * Create Empty 2 dimensions List
  * 
@@ -281,7 +660,7 @@ int length(struct ListX *pl);
 
 
 /** 
- * Return the number of list in the 2 dimensions list
+ * Return the number of list in the 2 dimensions list (kept up to date by appendList, O(1))
  * 
  * @param {struct ListXY *}    : refers to a 2 dimensions ball list (multiple draws)
  * @return {Integer}           : Return the number of list in the 2 dimensions list
@@ -522,7 +901,7 @@ void getKeys(struct ListX *pl, int *keys, int index, int count);
 
 
 /** 
- * Returns the list in the 2 dimensions list at the specified index
+ * Returns the list in the 2 dimensions list at the specified index (random access by the index of the lists, O(1))
  * 
  * @param {struct ListXY *}    : refers to a 2 dimensions ball list (multiple draws)
  * @param {Integer} ind        : index of 1 dimension list (a draw) in the 2 dimensions list (multi draws)
@@ -603,26 +982,25 @@ void printListXYByKey(struct ListXY *pl, FILE *fp);
 
 
 /** 
- * print ListXY With SuperStar ByKey
+ * print ListXY With bonus ball (SuperStar, PowerBall) ByKey
  * Print keys of the items (row by row) in the 2 dimensions lists
  * 
  * @param {struct ListXY *}    : refers to 2 dimensions ball list (winning numbers)
- * @param {struct ListXY *}    : refers to 2 dimensions ball list (superStar)
+ * @param {struct ListXY *}    : refers to 2 dimensions ball list (bonus balls)
  * @param {FILE *} fp          : refers to output file. If fp != NULL print to output file
  */
-void printListXYWithSSByKey(struct ListXY *pl1, struct ListXY *pl2, FILE *fp);
+void printListXYWithBonusByKey(struct ListXY *pl1, struct ListXY *pl2, FILE *fp);
 
 
 
 /** 
- * How many times the balls has been drawn so far
+ * How many times the balls has been drawn so far (counted over the rows of the drawn balls history)
  * 
- * @param {struct ListXY *} winningDrawnBallsList	: Drawn balls lists from file has been drawn so far
- * @param {struct ListXY *} superStarDrawnBallsList	: Drawn balls lists from file has been drawn so far
+ * @param {struct DrawHistory *} history		: refers to the drawn balls history
  * @param {struct ListX *} winningBallStats			: How many times were the winning numbers drawn in the previous draws?
- * @param {struct ListX *} superStarBallStats		: How many times were the superStar numbers drawn in the previous draws?
+ * @param {struct ListX *} bonusBallStats		: How many times were the bonusBall numbers drawn in the previous draws?
  */
-void getDrawnBallsStats(struct ListXY *winningDrawnBallsList, struct ListXY *superStarDrawnBallsList, struct ListX *winningBallStats, struct ListX *superStarBallStats);
+void getDrawnBallsStats(struct DrawHistory *history, struct ListX *winningBallStats, struct ListX *bonusBallStats);
 
 
 
@@ -630,8 +1008,9 @@ void getDrawnBallsStats(struct ListXY *winningDrawnBallsList, struct ListXY *sup
  * Print key-val pair of the items in the list by ball statistics (How many times the balls has been drawn so far)
  * 
  * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {FILE *} fp                     : refers to output file. If fp != NULL print to output file
  */
-void printBallStats(struct ListX *ballStats);
+void printBallStats(struct ListX *ballStats, FILE *fp);
 
 
 
@@ -655,152 +1034,374 @@ int numberOfTerm(int sum);
 
 
 
+/** 
+ * Seed the random number generator. The xoshiro128** state is filled from the seed with splitmix32, 
+ * RNG_LIBC seeds rand() with srand.
+ * 
+ * @param {struct Rng *} pr       : refers to a random number generator
+ * @param {Integer} type          : RNG_XOSHIRO or RNG_LIBC
+ * @param {unsigned long} seed    : seed
+ */
+void seedRng(struct Rng *pr, int type, unsigned long seed);
+
+
+
+/** 
+ * Returns the next random number of the generator
+ * 
+ * @param {struct Rng *} pr   : refers to a random number generator
+ * @return {unsigned int}     : random number (32 bits, 0-RAND_MAX if the generator is RNG_LIBC)
+ */
+unsigned int nextRng(struct Rng *pr);
+
+
+
+/** 
+ * Returns a random number between 0 and n-1 (without modulo bias, rand() % n if the generator is RNG_LIBC)
+ * 
+ * @param {struct Rng *} pr   : refers to a random number generator
+ * @param {Integer} n         : number of the values
+ * @return {Integer}          : random number between 0 and n-1
+ */
+int randRng(struct Rng *pr, int n);
+
+
+
+/** 
+ * Jump the generator 2^64 numbers ahead. Copying a generator and jumping the original gives an independent 
+ * stream (for a thread). No effect if the generator is RNG_LIBC.
+ * 
+ * @param {struct Rng *} pr   : refers to a random number generator
+ */
+void jumpRng(struct Rng *pr);
+
+
+
 /** 
  * The numbers that came out in the previous draws (ballStats) are arranged at the base of the pascal's triangle and the ball is dropped on 
  * (with gaussIndex function) it and the ball hit is drawn. The gaussIndex function returns the index (random) of one of the balls arranged 
  * at the base of pascal's triangle. If a ball is dropped from the top node of Pascal's triangle, it drops to the left or right each time 
  * it hits the node (like tossing a coin). The gaussIndex function moves towards the base of the triangle, making a random selection at 
  * each node. When it reaches the base of the triangle, it returns the index whichever node (index) it hits. 
+ * The index hit is 1 + binomial(ballCount-1, GAUSS_RIGHT), so it is taken from the alias table of the ball count 
+ * (gaussTable) with one random number. The walk is kept for RNG_LIBC (the draws of the earlier versions).
  * 
  * @param {Integer} ballCount      : Ball count in the globe
+ * @param {struct Rng *} rng       : refers to the random number generator
  * @return {Integer}               : Returns the random ball number (or ballStats index, you substract 1 from the return value for index)
  *                                   For example, ballCount = 90, it returns number between 1-90 (for index 0-89) (theoretically)
  *                                   Usually retuns the middle numbers
  */
-int gaussIndex(int ballCount);
+int gaussIndex(int ballCount, struct Rng *rng);
 
 
 
 /** 
- * Draw based on today's date
+ * Build the alias tables of gaussIndex for the ball counts 1..MAX_TOTAL_BALL (gaussTable)
+ */
+void initGauss();
+
+
+
+/** 
+ * Build the alias table (Vose's method) of the index distribution of gaussIndex for a ball count
  * 
- * @param {struct ListX *} drawnBallsDate1: refers to the balls to be drawn. 
- * @param {struct ListX *} drawnBallsDate2: refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {struct GaussTable *} pt : refers to an alias table
+ * @param {Integer} ballCount      : Ball count in the globe (1-MAX_TOTAL_BALL)
  */
-void drawBallByDate(struct ListX *drawnBallsDate1, struct ListX *drawnBallsDate2, struct ListX *ballStats);
+void buildGaussTable(struct GaussTable *pt, int ballCount);
 
 
 
 /** 
- * Draw random numbers
+ * Check the alias tables of gaussIndex against the walk on the pascal's triangle (--self-test), for the ball counts 
+ * of the games (90, 69, 60, 26). The distribution rebuilt from the alias table must be the binomial one, and the 
+ * indexes sampled from the alias table and from the walk (RNG_LIBC) must pass a chi-square test of homogeneity.
  * 
- * @param {struct ListX *} drawnBallsRand : refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
- * @param {Integer} totalBall             : Total ball count in the globe
- * @param {Integer} drawBall        	  : Number of balls to be drawn
- * @param {Integer} matchComb             : Number of combinations in which the drawn numbers must match any of the previous draws.
- * @param {Integer} elimComb              : If a combination of the drawn numbers matched with any of the previous draws, specified by the
- *                                          elimComb parameter, the draw is renewed.
- *                                          For example, a previous draw is [1, 2, 4, 6, 8, 9]
- *                                          the new draw (drawnBallsRand) is [1, 2, 5, 7, 9, 10]
- *                                          If matchComb = 2 and elimComb = 0, draw is OK, because (1,2) (1,9) or (2,9) matched.
- *                                          If matchComb = 2 and elimComb = 3, draw is renewed, because (1,2,9) eliminated. 
- * @return {struct ListX *} drawnBallsRand: Returns new drawn balls.
+ * @param {FILE *} fp     : refers to the output of the results
+ * @return {Integer}      : Returns 1 if every ball count passes, 0 if not
  */
-struct ListX * drawBallByRand(struct ListX *drawnBallsRand, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb);
+int testGauss(FILE *fp);
 
 
 
 /** 
- * The numbers that came out in the previous draws (ballStats) are arranged at the base of the pascal triangle
- * (stacked to the left) according to the number that comes out the most from the number that comes out the least, 
- * and the ball is dropped on (with gaussIndex function) it and the ball hit is drawn.
+ * Returns the chi-square value exceeded with the probability of 0.001 (Wilson-Hilferty approximation)
  * 
- * @param {struct ListX *} drawnBallsLeft : refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
- * @param {Integer} totalBall             : Total ball count in the globe
- * @param {Integer} drawBall        	  : Number of balls to be drawn
- * @param {Integer} matchComb             : Number of combinations in which the drawn numbers must match any of the previous draws.
- * @param {Integer} elimComb              : If a combination of the drawn numbers matched with any of the previous draws, specified by the
- *                                          elimComb parameter, the draw is renewed.
- * @return {struct ListX *} drawnBallsLeft: Returns new drawn balls.
+ * @param {Integer} df    : degrees of freedom
+ * @return {Double}       : critical value
  */
-struct ListX * drawBallByLeft(struct ListX *drawnBallsLeft, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb);
+double chiSquareLimit(int df);
 
 
 
 /** 
- * Blend 1
- * Dividing the list of numbers (ballStats) in the middle, inverting the left and right parts and combining them.
- * The numbers that came out in the previous draws (ballStats) are arranged at the base of the
- * pascal triangle and the ball is dropped on (with gaussIndex function) it and the ball hit is drawn.
+ * Empty the globe
  * 
- * @param {struct ListX *} drawnBallsBlend1 : refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats        : refers to balls and the number of times each ball was drawn in previous draws.
- * @param {Integer} totalBall				: Total ball count in the globe
- * @param {Integer} drawBall        	 	: Number of balls to be drawn
- * @param {Integer} matchComb               : Number of combinations in which the drawn numbers must match any of the previous draws.
- * @param {Integer} elimComb                : If a combination of the drawn numbers matched with any of the previous draws, specified by the
- *                                            elimComb parameter, the draw is renewed.
- * @return {struct ListX *} drawnBallsBlend1: Returns new drawn balls.
+ * @param {struct Globe *} pg : refers to a globe
  */
-struct ListX * drawBallByBlend1(struct ListX *drawnBallsBlend1, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb);
+void clearGlobe(struct Globe *pg);
 
 
 
 /** 
- * Blend 2
- * The balls are taken from the left and right of the ballStats and placed from the middle of the globe 
- * (The base of the Pascal's triangle) to the edges
+ * Put a ball at the left edge of the globe (index 0)
  * 
- * @param {struct ListX *} drawnBallsBlend2 : refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats        : refers to balls and the number of times each ball was drawn in previous draws.
- * @param {Integer} totalBall				: Total ball count in the globe
- * @param {Integer} drawBall        	 	: Number of balls to be drawn
- * @param {Integer} matchComb               : Number of combinations in which the drawn numbers must match any of the previous draws.
- * @param {Integer} elimComb                : If a combination of the drawn numbers matched with any of the previous draws, specified by the
- *                                            elimComb parameter, the draw is renewed.
- * @return {struct ListX *} drawnBallsBlend2: Returns new drawn balls.
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} key       : ball number
  */
-struct ListX * drawBallByBlend2(struct ListX *drawnBallsBlend2, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb);
+void insertGlobe(struct Globe *pg, int key);
 
 
 
 /** 
- * The balls that drawn the least are placed in the middle of the globe, and the balls that drawn the most are placed on the edges.
+ * Put a ball at the right edge of the globe (index count-1)
  * 
- * @param {struct ListX *} drawnBallsSide   : refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats        : refers to balls and the number of times each ball was drawn in previous draws.
- * @param {Integer} totalBall				: Total ball count in the globe
- * @param {Integer} drawBall        	  	: Number of balls to be drawn
- * @param {Integer} matchComb               : Number of combinations in which the drawn numbers must match any of the previous draws.
- * @param {Integer} elimComb                : If a combination of the drawn numbers matched with any of the previous draws, specified by the
- *                                            elimComb parameter, the draw is renewed.
- * @return {struct ListX *} drawnBallsSide  : Returns new drawn balls.
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} key       : ball number
  */
-struct ListX * drawBallBySide(struct ListX *drawnBallsSide, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb);
+void appendGlobe(struct Globe *pg, int key);
 
 
 
 /** 
- * The most drawn balls are placed in the center of the globe,
- * the least drawn balls are placed at the edges (normal distribution)
+ * Add a ball at the specified index of the globe, the balls from the index are shifted to the right.
+ * As addItemByIndex, a ball already in the globe or an index past the end of the globe is not added.
  * 
- * @param {struct ListX *} drawnBallsNorm : refers to the balls to be drawn. 
- * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
- * @param {Integer} totalBall			  : Total ball count in the globe
- * @param {Integer} drawBall        	  : Number of balls to be drawn
- * @param {Integer} matchComb             : Number of combinations in which the drawn numbers must match any of the previous draws.
- * @param {Integer} elimComb              : If a combination of the drawn numbers matched with any of the previous draws, specified by the
- *                                          elimComb parameter, the draw is renewed.
- *                                          For example, a previous draw is [1, 2, 4, 6, 8, 9]
- *                                          the new draw (drawnBallsNorm) is [1, 2, 5, 7, 9, 10]
- *                                          If matchComb = 2 and elimComb = 0, draw is OK, because (1,2) (1,9) or (2,9) matched.
- *                                          If matchComb = 2 and elimComb = 3, draw is renewed, because (1,2,9) eliminated. 
- * @return {struct ListX *} drawnBallsNorm: Returns new drawn balls.
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} ind       : index
+ * @param {Integer} key       : ball number
+ * @return {Integer}          : Returns 1 if the ball is added, 0 if not
  */
-struct ListX * drawBallByNorm(struct ListX *drawnBallsNorm, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb);
+int addGlobeByIndex(struct Globe *pg, int ind, int key);
 
 
 
 /** 
- * The findComb function searches for combinations specified by the comb parameter in previous draws. 
+ * Remove the ball at the specified index of the globe, the balls after the index are shifted to the left.
+ * 
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} ind       : index
+ * @return {Integer}          : Returns the ball number, 0 if the index is out of the globe
+ */
+int removeGlobeByIndex(struct Globe *pg, int ind);
+
+
+
+/** 
+ * Move the ball at the specified index to the left edge of the globe (removeGlobeByIndex + insertGlobe in one shift)
+ * 
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} ind       : index
+ */
+void moveBallToLeft(struct Globe *pg, int ind);
+
+
+
+/** 
+ * Move the ball at the specified index to the right edge of the globe (removeGlobeByIndex + appendGlobe in one shift)
+ * 
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} ind       : index
+ */
+void moveBallToRight(struct Globe *pg, int ind);
+
+
+
+/** 
+ * Shuffle the globe. A ball at a random index flies to the left edge of the globe if it is on the left of the middle, 
+ * to the right edge if it is on the right, the two balls in the middle stay. The random indexes are generated 
+ * in batches of SHUFFLE_BATCH, then the balls of the batch are moved. 
+ * The balls on the left of the middle only move among themselves, so do the balls on the right, so the moves are 
+ * random walks on the orders of the two sides converging to the uniform orders. Once there are count*count moves the 
+ * sides are mixed, the uniform orders are taken at once (shuffleBalls). The libc generator keeps the moves of the 
+ * earlier versions.
+ * 
+ * @param {struct Globe *} pg : refers to a globe
+ * @param {Integer} totalBall : Total ball count (the middle of the globe is totalBall/2)
+ * @param {Integer} moves     : Number of random indexes (balls flying)
+ * @param {struct Rng *} rng  : refers to the random number generator
+ */
+void mixGlobe(struct Globe *pg, int totalBall, unsigned int moves, struct Rng *rng);
+
+
+
+/** 
+ * Shuffle the balls into a uniform random order (Fisher-Yates)
+ * 
+ * @param {Integer *} balls  : balls
+ * @param {Integer} count    : number of the balls
+ * @param {struct Rng *} rng : refers to the random number generator
+ */
+void shuffleBalls(int *balls, int count, struct Rng *rng);
+
+
+
+/** 
+ * Draw balls from the globe without replacement. An index of the globe is hit with the gaussIndex probabilities 
+ * (gaussTable weights) renormalized over the balls not drawn yet, so a valid draw takes exactly drawBall steps. 
+ * For RNG_LIBC, the balls are drawn with gaussIndex and redrawn while they are already drawn (the draws of the 
+ * earlier versions).
+ * 
+ * @param {struct Globe *} pg         : refers to a globe
+ * @param {struct ListX *} drawnBalls : the drawn balls are appended to this list
+ * @param {Integer} drawBall          : Number of balls to be drawn
+ * @param {struct Rng *} rng          : refers to the random number generator
+ */
+void drawGlobeBalls(struct Globe *pg, struct ListX *drawnBalls, int drawBall, struct Rng *rng);
+
+
+
+/** 
+ * Fill inside the globe with the balls of ballStats (in the order they are sorted)
+ * 
+ * @param {struct Globe *} pg         : refers to a globe
+ * @param {struct ListX *} ballStats  : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall         : Total ball count in the globe
+ * @param {Integer} layout            : GLOBE_LEFT, GLOBE_BLEND1, GLOBE_BLEND2 or GLOBE_SIDE
+ */
+void fillGlobe(struct Globe *pg, struct ListX *ballStats, int totalBall, int layout);
+
+
+
+/** 
+ * Draw based on today's date
+ * 
+ * @param {struct ListX *} drawnBallsDate1: refers to the balls to be drawn. 
+ * @param {struct ListX *} drawnBallsDate2: refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {struct Rng *} rng              : refers to the random number generator
+ */
+void drawBallByDate(struct ListX *drawnBallsDate1, struct ListX *drawnBallsDate2, struct ListX *ballStats, struct Rng *rng);
+
+
+
+/** 
+ * Draw random numbers
+ * 
+ * @param {struct ListX *} drawnBallsRand : refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall             : Total ball count in the globe
+ * @param {Integer} drawBall        	  : Number of balls to be drawn
+ * @param {Integer} matchComb             : Number of combinations in which the drawn numbers must match any of the previous draws.
+ * @param {Integer} elimComb              : If a combination of the drawn numbers matched with any of the previous draws, specified by the
+ *                                          elimComb parameter, the draw is renewed.
+ *                                          For example, a previous draw is [1, 2, 4, 6, 8, 9]
+ *                                          the new draw (drawnBallsRand) is [1, 2, 5, 7, 9, 10]
+ *                                          If matchComb = 2 and elimComb = 0, draw is OK, because (1,2) (1,9) or (2,9) matched.
+ *                                          If matchComb = 2 and elimComb = 3, draw is renewed, because (1,2,9) eliminated. 
+ * @param {struct Rng *} rng              : refers to the random number generator
+ * @return {struct ListX *} drawnBallsRand: Returns new drawn balls.
+ */
+struct ListX * drawBallByRand(struct ListX *drawnBallsRand, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng);
+
+
+
+/** 
+ * The numbers that came out in the previous draws (ballStats) are arranged at the base of the pascal triangle
+ * (stacked to the left) according to the number that comes out the most from the number that comes out the least, 
+ * and the ball is dropped on (with gaussIndex function) it and the ball hit is drawn.
+ * 
+ * @param {struct ListX *} drawnBallsLeft : refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall             : Total ball count in the globe
+ * @param {Integer} drawBall        	  : Number of balls to be drawn
+ * @param {Integer} matchComb             : Number of combinations in which the drawn numbers must match any of the previous draws.
+ * @param {Integer} elimComb              : If a combination of the drawn numbers matched with any of the previous draws, specified by the
+ *                                          elimComb parameter, the draw is renewed.
+ * @param {struct Rng *} rng              : refers to the random number generator
+ * @return {struct ListX *} drawnBallsLeft: Returns new drawn balls.
+ */
+struct ListX * drawBallByLeft(struct ListX *drawnBallsLeft, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng);
+
+
+
+/** 
+ * Blend 1
+ * Dividing the list of numbers (ballStats) in the middle, inverting the left and right parts and combining them.
+ * The numbers that came out in the previous draws (ballStats) are arranged at the base of the
+ * pascal triangle and the ball is dropped on (with gaussIndex function) it and the ball hit is drawn.
+ * 
+ * @param {struct ListX *} drawnBallsBlend1 : refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats        : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall				: Total ball count in the globe
+ * @param {Integer} drawBall        	 	: Number of balls to be drawn
+ * @param {Integer} matchComb               : Number of combinations in which the drawn numbers must match any of the previous draws.
+ * @param {Integer} elimComb                : If a combination of the drawn numbers matched with any of the previous draws, specified by the
+ *                                            elimComb parameter, the draw is renewed.
+ * @param {struct Rng *} rng                : refers to the random number generator
+ * @return {struct ListX *} drawnBallsBlend1: Returns new drawn balls.
+ */
+struct ListX * drawBallByBlend1(struct ListX *drawnBallsBlend1, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng);
+
+
+
+/** 
+ * Blend 2
+ * The balls are taken from the left and right of the ballStats and placed from the middle of the globe 
+ * (The base of the Pascal's triangle) to the edges
+ * 
+ * @param {struct ListX *} drawnBallsBlend2 : refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats        : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall				: Total ball count in the globe
+ * @param {Integer} drawBall        	 	: Number of balls to be drawn
+ * @param {Integer} matchComb               : Number of combinations in which the drawn numbers must match any of the previous draws.
+ * @param {Integer} elimComb                : If a combination of the drawn numbers matched with any of the previous draws, specified by the
+ *                                            elimComb parameter, the draw is renewed.
+ * @param {struct Rng *} rng                : refers to the random number generator
+ * @return {struct ListX *} drawnBallsBlend2: Returns new drawn balls.
+ */
+struct ListX * drawBallByBlend2(struct ListX *drawnBallsBlend2, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng);
+
+
+
+/** 
+ * The balls that drawn the least are placed in the middle of the globe, and the balls that drawn the most are placed on the edges.
+ * 
+ * @param {struct ListX *} drawnBallsSide   : refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats        : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall				: Total ball count in the globe
+ * @param {Integer} drawBall        	  	: Number of balls to be drawn
+ * @param {Integer} matchComb               : Number of combinations in which the drawn numbers must match any of the previous draws.
+ * @param {Integer} elimComb                : If a combination of the drawn numbers matched with any of the previous draws, specified by the
+ *                                            elimComb parameter, the draw is renewed.
+ * @param {struct Rng *} rng                : refers to the random number generator
+ * @return {struct ListX *} drawnBallsSide  : Returns new drawn balls.
+ */
+struct ListX * drawBallBySide(struct ListX *drawnBallsSide, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng);
+
+
+
+/** 
+ * The most drawn balls are placed in the center of the globe,
+ * the least drawn balls are placed at the edges (normal distribution)
+ * 
+ * @param {struct ListX *} drawnBallsNorm : refers to the balls to be drawn. 
+ * @param {struct ListX *} ballStats      : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {Integer} totalBall			  : Total ball count in the globe
+ * @param {Integer} drawBall        	  : Number of balls to be drawn
+ * @param {Integer} matchComb             : Number of combinations in which the drawn numbers must match any of the previous draws.
+ * @param {Integer} elimComb              : If a combination of the drawn numbers matched with any of the previous draws, specified by the
+ *                                          elimComb parameter, the draw is renewed.
+ *                                          For example, a previous draw is [1, 2, 4, 6, 8, 9]
+ *                                          the new draw (drawnBallsNorm) is [1, 2, 5, 7, 9, 10]
+ *                                          If matchComb = 2 and elimComb = 0, draw is OK, because (1,2) (1,9) or (2,9) matched.
+ *                                          If matchComb = 2 and elimComb = 3, draw is renewed, because (1,2,9) eliminated. 
+ * @param {struct Rng *} rng              : refers to the random number generator
+ * @return {struct ListX *} drawnBallsNorm: Returns new drawn balls.
+ */
+struct ListX * drawBallByNorm(struct ListX *drawnBallsNorm, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng);
+
+
+
+/** 
+ * The findComb function searches for combinations specified by the comb parameter in previous draws. 
  * For example, the numbers [1, 2, 4, 6, 8, 9] were drawn in one of the previous draws. 
  * The newly drawn numbers are drawnBalls = [1, 2, 5, 7, 9, 10]. 
  * findComb(drawnBalls, 3) searches for 3-combinations in drawnBalls in previous draws.
  * The findComb function returns 1 because there are matching triple combination (1,2,9). 
  * The comb parameter can take values 2, 3, 4, 5 and 6. 
+ * The comb-combinations of drawnBalls are looked up in the combination filter (combFilter), C(DRAW_BALL, comb) probes.
  *
  * @param {struct ListX *} drawnBalls : refers to balls drawn in a draw. 
  * @param {Integer} comb              : ball combinations
@@ -810,6 +1411,116 @@ int findComb(struct ListX *drawnBalls, int comb);
 
 
 
+/** 
+ * Clear the ball bitmask
+ * 
+ * @param {struct BallMask *} mask : refers to a ball bitmask
+ */
+void clearMask(struct BallMask *mask);
+
+
+
+/** 
+ * Add a ball to the ball bitmask
+ * 
+ * @param {struct BallMask *} mask : refers to a ball bitmask
+ * @param {Integer} key            : the key (ball number) to be added
+ */
+void setMaskBall(struct BallMask *mask, int key);
+
+
+
+/** 
+ * Check if the ball is in the ball bitmask
+ * 
+ * @param {struct BallMask *} mask : refers to a ball bitmask
+ * @param {Integer} key            : the key (ball number) to be checked
+ * @return {Integer}               : Returns 1 if the ball is in the bitmask, 0 if not.
+ */
+int testMaskBall(struct BallMask *mask, int key);
+
+
+
+/** 
+ * Returns the ball bitmask of the row of the drawn balls history
+ * 
+ * @param {unsigned char *} row    : refers to a row (DRAW_BALL balls)
+ * @param {struct BallMask *} mask : the ball bitmask is assigned to this address
+ */
+void getRowMask(unsigned char *row, struct BallMask *mask);
+
+
+
+/** 
+ * Returns the ball bitmask of the first "count" items (balls) in the list
+ * 
+ * @param {struct ListX *} pl      : refers to a ball list
+ * @param {Integer} count          : number of items (balls) to be added to the bitmask
+ * @param {struct BallMask *} mask : the ball bitmask is assigned to this address
+ */
+void getListMask(struct ListX *pl, int count, struct BallMask *mask);
+
+
+
+/** 
+ * Returns the number of bits set in the word
+ * 
+ * @param {unsigned long} word : a word of the ball bitmask
+ * @return {Integer}           : number of bits set
+ */
+int popCount(unsigned long word);
+
+
+
+/** 
+ * Returns the number of balls two draws have in common. Two draws match a combination of n balls 
+ * if they have at least n balls in common.
+ * 
+ * @param {struct BallMask *} mask1 : ball bitmask of the first draw
+ * @param {struct BallMask *} mask2 : ball bitmask of the second draw
+ * @return {Integer}                : number of common balls
+ */
+int countCommon(struct BallMask *mask1, struct BallMask *mask2);
+
+
+
+/** 
+ * Moves the indexes to the next combination (in lexicographic order) of "comb" indexes from "count" indexes
+ * 
+ * @param {Integer *} ind   : indexes of the current combination (0, 1, .. comb-1 for the first combination)
+ * @param {Integer} comb    : number of indexes in the combination
+ * @param {Integer} count   : number of indexes to choose from
+ * @return {Integer}        : Returns 1 if there is a next combination, 0 if not.
+ */
+int nextCombIndex(int *ind, int comb, int count);
+
+
+
+/** 
+ * The searchCombXY function searches for "comb" combinations in all previous draws (searches in 2 dimensions list). 
+ * 
+ * @param {struct ListXY *} prvDrawnsList : refers to the balls has been drawn so far. 
+ * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
+ * @param {Integer} comb                  : number of balls in the combination (2-6)
+ * @return {Integer}                      : Returns 1 if found, 0 if not. 
+ */
+int searchCombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls, int comb);
+
+
+
+/** 
+ * The searchCombX function searches for "comb" combinations in a previous draw. 
+ * 
+ * @param {unsigned char *} aPrvDrawn    : refers to a drawn balls in the previous draws (row of the drawn balls history).
+ * @param {unsigned char *} drawnBalls   : refers to balls drawn in a new draw (row of the drawn balls history). 
+ * @param {Integer} comb                  : number of balls in the combination (2-6)
+ * @param {char *} buf                    : If this parameter is not set to NULL, matching combinations are assigned to this address as string
+ * @return {Integer}                      : Returns 1 if found, 0 if not. 
+ */
+int searchCombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, int comb, char *buf);
+
+
+
 /** 
  * The search6CombXY function searches for 6 combinations in all previous draws (searches in 2 dimensions list). 
  * 
@@ -824,11 +1535,11 @@ int search6CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls);
 /** 
  * The search6CombX function searches for 6 combinations in a previous draws (searches in 1 dimension list). 
  * 
- * @param {struct ListX *} aPrvDrawn      : refers to a drawn balls in the previous draws.
- * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
+ * @param {unsigned char *} aPrvDrawn    : refers to a drawn balls in the previous draws (row of the drawn balls history).
+ * @param {unsigned char *} drawnBalls   : refers to balls drawn in a new draw (row of the drawn balls history). 
  * @return {Integer}                      : Returns 1 if found, 0 if not. 
  */
-int search6CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls);
+int search6CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls);
 
 
 
@@ -846,12 +1557,12 @@ int search5CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls);
 /** 
  * The search5CombX function searches for 5 combinations in a previous draw. 
  * 
- * @param {struct ListX *} aPrvDrawn      : refers to a drawn balls in the previous draws.
- * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
+ * @param {unsigned char *} aPrvDrawn    : refers to a drawn balls in the previous draws (row of the drawn balls history).
+ * @param {unsigned char *} drawnBalls   : refers to balls drawn in a new draw (row of the drawn balls history). 
  * @param {char *} buf                    : If this parameter is not set to NULL, matching combinations are assigned to this address as string
  * @return {Integer}                      : Returns 1 if found, 0 if not. 
  */
-int search5CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, char *buf);
+int search5CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf);
 
 
 
@@ -869,13 +1580,12 @@ int search4CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls);
 /** 
  * The search4CombX function searches for 4 combinations in a previous draw. 
  * 
- * @param {struct ListX *} aPrvDrawn      : refers to a drawn balls in the previous draws.
- * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
- * @param {struct ListXY *} luckyBalls    : quartet combinations numbers list that love each other drawn together (lucky numbers)
+ * @param {unsigned char *} aPrvDrawn    : refers to a drawn balls in the previous draws (row of the drawn balls history).
+ * @param {unsigned char *} drawnBalls   : refers to balls drawn in a new draw (row of the drawn balls history). 
  * @param {char *} buf                    : If this parameter is not set to NULL, matching combinations are assigned to this address as string
  * @return {Integer}                      : Returns 1 if found, 0 if not. 
  */
-int search4CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListXY *luckyBalls, char *buf);
+int search4CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf);
 
 
 
@@ -893,13 +1603,12 @@ int search3CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls);
 /** 
  * The search3CombX function searches for 3 combinations in a previous draw. 
  * 
- * @param {struct ListX *} aPrvDrawn      : refers to a drawn balls in the previous draws.
- * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
- * @param {struct ListXY *} luckyBalls    : triple combinations numbers list that love each other drawn together (lucky numbers)
+ * @param {unsigned char *} aPrvDrawn    : refers to a drawn balls in the previous draws (row of the drawn balls history).
+ * @param {unsigned char *} drawnBalls   : refers to balls drawn in a new draw (row of the drawn balls history). 
  * @param {char *} buf                    : If this parameter is not set to NULL, matching combinations are assigned to this address as string
  * @return {Integer}                      : Returns 1 if found, 0 if not. 
  */
-int search3CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListXY *luckyBalls, char *buf);
+int search3CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf);
 
 
 
@@ -917,13 +1626,12 @@ int search2CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls);
 /** 
  * The search2CombX function searches for 2 combinations in a previous draw. 
  * 
- * @param {struct ListX *} aPrvDrawn      : refers to a drawn balls in the previous draws.
- * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
- * @param {struct ListXY *} luckyBalls    : double combinations numbers list that love each other drawn together (lucky numbers)
+ * @param {unsigned char *} aPrvDrawn    : refers to a drawn balls in the previous draws (row of the drawn balls history).
+ * @param {unsigned char *} drawnBalls   : refers to balls drawn in a new draw (row of the drawn balls history). 
  * @param {char *} buf                    : If this parameter is not set to NULL, matching combinations are assigned to this address as string
  * @return {Integer}                      : Returns 1 if found, 0 if not. 
  */
-int search2CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListXY *luckyBalls, char *buf);
+int search2CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf);
 
 
 
@@ -932,7 +1640,7 @@ int search2CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListX
  * 
  * @param {struct ListXY *} couponList    : refers to the balls has been new drawns. 
  * @param {struct ListX *} drawnBalls     : refers to balls drawn in a new draw. 
- * @param {Integer} drawBall     		  : DRAW_BALL for normal ball list or 1 for powerBall list (coupon column count)
+ * @param {Integer} drawBall     		  : DRAW_BALL for normal ball list or 1 for bonus ball list (coupon column count)
  * @return {Integer}                      : Returns 1 if found, 0 if not. 
  */
 int search1BallXY(struct ListXY *couponList, struct ListX *drawnBalls, int drawBall);
@@ -955,3636 +1663,5336 @@ void calcMatchCombCount();
 
 
 
-/**
- * Calculate matching combinations of numbers from previous draws
+/** 
+ * Compares the draws first..last-1 with the following draws and counts the matched combinations (thread function)
  * 
- * @param {Integer} comb    : If 2, it prints matching double combinations along with their dates
- *                            If 3, it prints matching triple combinations along with their dates
- *                            If 4, it prints matching quartet combinations along with their dates
- *                            If 5, it prints matching quintuple combinations along with their dates
- *                            If 6, it prints matching six combinations along with their dates
- * @param {FILE *} fp       : refers to output file. If fp != NULL print to output file
-*/
-void calcCombMatch(int comb, FILE *fp);
+ * @param {void *} arg  : refers to the work of the thread (struct MatchCombWork)
+ * @return {void *}     : NULL
+ */
+void *matchCombWorker(void *arg);
 
 
 
-/**
- * Get the numbers that love each other drawn together (lucky numbers)
+/** 
+ * Splits the rows of the triangular loop (row i is compared with rows i+1..count-1) into parts of nearly equal work
  * 
- * @param {struct ListXY *} luckyBalls    : refers to the lucky balls list
- * @param {Integer} comb                  : double, triple or quartet (2, 3 or 4) combinations
- * @return {struct ListXY *} luckyBalls   : refers to the lucky balls list
-*/
-struct ListXY * getLuckyBalls(struct ListXY *luckyBalls, int comb);
+ * @param {Integer} count    : number of rows
+ * @param {Integer} parts    : number of parts
+ * @param {Integer *} bounds : part t is the rows bounds[t]..bounds[t+1]-1 (parts+1 entries are assigned)
+ */
+void splitTriangle(int count, int parts, int *bounds);
 
 
 
-/**
- * Draw balls by lucky numbers (the numbers that love each other drawn together)
+/** 
+ * Runs the worker function for each work, on worker threads if they are available (otherwise one by one)
  * 
- * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
- * @param {Integer} drawNum           : 1: lucky 3, 2: 2 of lucky3, 3: lucky 2
- * @param {Integer} totalDrawCount    : Total draw count
-*/
-void drawBallsByLucky(struct ListXY *coupon, int drawNum, int totalDrawCount);
+ * @param {void *(*)(void *)} worker : worker (thread) function
+ * @param {void *} works             : refers to the array of the works
+ * @param {size_t} workSize          : size of a work
+ * @param {Integer} count            : number of works (at most MAX_THREADS)
+ */
+void runWorkers(void *(*worker)(void *), void *works, size_t workSize, int count);
 
 
 
-/**
- * Draw balls
+/** 
+ * Returns the number of the online processors (1 if it is not known)
  * 
- * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
- * @param {Integer} totalDrawCount    : how many draws will be made
- * @param {Integer} drawByDate		  : If 1 draw balls by date, if 0 don't draw balls by date.
- * @param {Integer} drawByNorm		  : If 1 draw, if 0 don't draw.
- * @param {Integer} drawByLeft		  : If 1 draw, if 0 don't draw.
- * @param {Integer} drawByBlend1	  : If 1 draw, if 0 don't draw.
- * @param {Integer} drawByBlend2	  : If 1 draw, if 0 don't draw.
- * @param {Integer} drawBySide		  : If 1 draw, if 0 don't draw.
- * @param {Integer} drawByRand		  : If 1 draw, if 0 don't draw.
- * @param {Integer} drawByLucky		  : If 1 draw, if 0 don't draw.
-*/
-void drawBalls(struct ListXY *coupon, int totalDrawCount, int drawByDate, int drawByNorm, int drawByLeft, int drawByBlend1, int drawByBlend2, int drawBySide, int drawByRand, int drawByLucky)
-;
+ * @return {Integer} : number of the processors
+ */
+int getCpuCount();
 
 
 
-/**
- * Draw SuperStar ball
+/** 
+ * Parse the command line options
  * 
- * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
- * @param {Integer} drawCount         : how many draws will be made
-*/
-void drawSuperStar(struct ListXY *coupon, int drawCount);
+ * @param {Integer} argc   : number of the arguments
+ * @param {char *[]} argv  : arguments
+ */
+void parseArgs(int argc, char *argv[]);
 
 
 
 /** 
- * Get drawn balls from file has been drawn so far
+ * Parse the draw strategies of the batch mode
  * 
- * @param {struct ListXY *}      : refer to 2 dimensions list of winning numbers
- * @param {struct ListXY *}      : refer to 2 dimensions list of SuperStar numbers
- * @param {char *}               : Drawn list file
+ * @param {char *} names : comma separated strategies (date, norm, left, blend1, blend2, side, rand, lucky or all)
+ * @return {Integer}     : strategy flags (STRATEGY_DATE | ...), 0 if a strategy is unknown
  */
-void getDrawnBallsList(struct ListXY * winningDrawnBallsList, struct ListXY * superStarDrawnBallsList, char *fileName);
+int parseStrategy(char *names);
 
 
 
-/* FUNCTIONS */
-
+/** 
+ * Parse the command of the command line
+ * 
+ * @param {char *} name : stats, draw, match, lucky or add-draw
+ * @return {Integer}    : COMMAND_STATS, COMMAND_DRAW, COMMAND_MATCH, COMMAND_LUCKY or COMMAND_ADD, 0 if it is not a command
+ */
+int parseCommand(char *name);
 
-struct ListX *createListX(struct ListX *pl, char *date, char *label, int val)
-{
-	pl = (struct ListX *) malloc(sizeof(struct ListX));
-	pl->head = NULL;
-	pl->next = NULL;
 
-	if (date) {
-		pl->date = (char *) malloc(sizeof(char)*11);
-		strcpy(pl->date, date);
-	} else {
-		pl->date = NULL;
-	}
 
-	if (label) {
-		pl->label = (char *) malloc(sizeof(char)*30);
-		strcpy(pl->label, label);
-	} else {
-		pl->label = NULL;
-	}
+/** 
+ * Returns the game by name
+ * 
+ * @param {char *} name : sayisal, super or powerball
+ * @return {Integer}    : GAME_SAYISAL, GAME_SUPER or GAME_POWERBALL, -1 if it is not a game
+ */
+int findGame(char *name);
 
-	pl->val = val;
-	return pl;
-}
 
 
+/** 
+ * Run a command of the command line and write its results to the output
+ * 
+ * @param {Integer} cmd        : COMMAND_STATS (ball statistics and matched combination counts), COMMAND_DRAW (draw commandCount rows), 
+ *                               COMMAND_MATCH (matched commandK combinations), COMMAND_LUCKY (numbers that love each other, commandK numbers) 
+ *                               or COMMAND_ADD (add the draw of commandRow)
+ * @param {FILE *} fp          : refers to the output (stdout or the file of the -o option)
+ * @param {struct Rng *} rng   : refers to a random number generator
+ */
+void runCommand(int cmd, FILE *fp, struct Rng *rng);
 
-struct ListXY *createListXY(struct ListXY *pl)
-{
-	pl = (struct ListXY *) malloc(sizeof(struct ListXY));
-	pl->list = NULL;
-	return pl;
-}
 
 
+/** 
+ * Add a new draw (add-draw) to the top of the statistics file. The draw is compared with the draws so far once 
+ * (the matched combination counts), then the statistics file and the binary history cache are written with the new draw. 
+ * The ball statistics and the combination indexes are made from the cache at the next launch.
+ * 
+ * @param {char *} row    : date and numbers of the draw, as a row of the statistics file
+ * @param {FILE *} fp     : refers to the output (stdout or the file of the -o option)
+ * @return {Integer}      : Returns 1 if the draw is added, 0 if the row is malformed, the date is not after the 
+ *                          last draw or the statistics file can't be written
+ */
+int addDraw(char *row, FILE *fp);
 
-void insertItem(struct ListX *pl, int key)
-{
-	struct Item *pt = (struct Item *) malloc(sizeof(struct Item));
-	pt->key = key;
-	pt->next = pl->head;
-	pl->head = pt;
-}
 
 
+/** 
+ * Write the statistics file again with a new row at the top (through a temporary file, with the line ends of the file). 
+ * The temporary file is renamed over the statistics file, it is kept if the rename fails.
+ * 
+ * @param {char *} fileName : statistics file
+ * @param {char *} line     : new row (without the line end)
+ * @return {Integer}        : Returns 1 if the file is written, 0 if not
+ */
+int prependStatsLine(char *fileName, char *line);
 
-struct Item *atEnd(struct ListX *pl)
-{
-	struct Item *curr;
 
-	if (pl->head == NULL)
-		return NULL;
 
-	curr = pl->head;
+/** 
+ * Returns the elapsed time (wall clock if it is known, processor time otherwise)
+ * 
+ * @return {double} : time in seconds
+ */
+double getTime();
 
-	while (curr->next)
-		curr = curr->next;
 
-	return curr;
-}
 
+/**
+ * Calculate matching combinations of numbers from previous draws
+ * 
+ * @param {Integer} comb    : If 2, it prints matching double combinations along with their dates
+ *                            If 3, it prints matching triple combinations along with their dates
+ *                            If 4, it prints matching quartet combinations along with their dates
+ *                            If 5, it prints matching quintuple combinations along with their dates
+ *                            If 6, it prints matching six combinations along with their dates
+ * @param {FILE *} fp       : refers to output file. If fp != NULL print to output file
+*/
+void calcCombMatch(int comb, FILE *fp);
 
 
-struct ListX *atEndY(struct ListXY *pl)
-{
-	struct ListX *curr;
 
-	if (pl == NULL)
-		return NULL;
+/**
+ * Get the numbers that love each other drawn together (lucky numbers)
+ * 
+ * @param {struct ListXY *} luckyBalls    : refers to the lucky balls list
+ * @param {Integer} comb                  : double, triple or quartet (2, 3 or 4) combinations
+ * @return {struct ListXY *} luckyBalls   : refers to the lucky balls list
+*/
+struct ListXY * getLuckyBalls(struct ListXY *luckyBalls, int comb);
 
-	curr = pl->list;
 
-	while (curr->next)
-		curr = curr->next;
 
-	return curr;
-}
+/** 
+ * Create Empty co-occurrence index (numbers that love each other drawn together)
+ * 
+ * @param {struct LuckyIndex *} pi : refers to a co-occurrence index
+ * @return {struct LuckyIndex *}   : refers to the co-occurrence index (memory allocated)
+ */
+struct LuckyIndex *createLuckyIndex(struct LuckyIndex *pi);
 
 
 
-void appendItem(struct ListX *pl, int key)
-{
-	struct Item *pt = (struct Item *) malloc(sizeof(struct Item));
-	pt->key = key;
-	pt->next = NULL;
+/** 
+ * Returns the occurrences of the "comb" combinations by rank. Counts them over the drawn balls history on first use.
+ * 
+ * @param {struct LuckyIndex *} pi  : refers to a co-occurrence index
+ * @param {Integer} comb            : double, triple or quartet (2, 3 or 4) combinations
+ * @return {struct CombCount *}     : occurrences of the combinations (C(TOTAL_BALL, comb) entries, indexed by rankComb)
+ */
+struct CombCount *getLuckyCounts(struct LuckyIndex *pi, int comb);
 
-	if (pl->head == NULL)
-		pl->head = pt;
-	else
-		(atEnd(pl))->next = pt;
-}
 
 
+/** 
+ * Ranks the "comb" combinations of the draws firstRow..lastRow-1 into the ranks of the draws (thread function)
+ * 
+ * @param {void *} arg  : refers to the work of the thread (struct LuckyWork)
+ * @return {void *}     : NULL
+ */
+void *luckyRankWorker(void *arg);
 
-void appendItems(struct ListX *pl, int *keys)
-{
-	int i;
-	struct Item *pt[DRAW_BALL];
 
-	for (i=0; keys[i] != '\0'; i++) {
-		pt[i] = (struct Item *) malloc(sizeof(struct Item));
-		pt[i]->key = keys[i];
-		if (i>0) pt[i-1]->next = pt[i];
-	}
 
-	pt[i-1]->next = NULL;
+/** 
+ * Counts the "comb" combinations ranked first..last-1 over the ranks of the draws (thread function)
+ * 
+ * @param {void *} arg  : refers to the work of the thread (struct LuckyWork)
+ * @return {void *}     : NULL
+ */
+void *luckyCountWorker(void *arg);
 
-	if (pl->head == NULL)
-		pl->head = pt[0];
-	else
-		(atEnd(pl))->next = pt[0];
-}
 
 
+/** 
+ * Collects the combinations ranked first..last-1 drawn in at least 2 draws into the partial table of the thread (thread function)
+ * 
+ * @param {void *} arg  : refers to the work of the thread (struct LuckyWork)
+ * @return {void *}     : NULL
+ */
+void *luckyEntryWorker(void *arg);
 
-void appendList(struct ListXY *pl, struct ListX *plNext)
-{
-	if (pl == NULL) return;
 
-	if (pl->list == NULL)
-		pl->list = plNext;
-	else {
-		(atEndY(pl))->next = plNext;
-		plNext->next = NULL;
-	}
-}
 
+/** 
+ * Splits the ranks of the "comb" combinations and the draws into a work for each thread
+ * 
+ * @param {struct LuckyWork *} works : the works are assigned to this address (threadCount works)
+ * @param {Integer} comb             : double, triple or quartet (2, 3 or 4) combinations
+ * @param {struct CombCount *} counts: occurrences of the combinations by rank
+ */
+void splitLuckyWorks(struct LuckyWork *works, int comb, struct CombCount *counts);
 
 
-void removeItemByKey(struct ListX *pl, int key)
-{
-	struct Item *prv, *pt = pl->head;
 
-	if (pt) {
-		if (pt->key == key) {
-			pl->head = pt->next;
-			free(pt);
-		} else {
-			for (prv=pt, pt=pt->next; ((pt) && (pt->key != key)); prv=prv->next, pt=pt->next);
+/** 
+ * Fill the table of the binomial coefficients (binomTable)
+ */
+void initBinom();
 
-			if (pt->key == key) {
-				prv->next = pt->next;
-				free(pt);
-			}
-		}
-	}
-}
 
 
+/** 
+ * Returns the binomial coefficient C(n, k), the number of k combinations of n balls
+ * 
+ * @param {Integer} n  : number of balls (0-TOTAL_BALL)
+ * @param {Integer} k  : number of balls in the combination (0-DRAW_BALL)
+ * @return {Long}      : C(n, k), 0 if k > n
+ */
+long choose(int n, int k);
 
-int removeItemByIndex(struct ListX *pl, int ind)
-{
-	struct Item *prv, *pt = pl->head;
-	int i, key = 0;
 
-	if (pt) {
-		if (ind == 0) {
-			key = pt->key;
-			pl->head = pt->next;
-			free(pt);
-		} else {
-			for (i=1, prv=pt, pt=pt->next; (pt) && (i<ind); prv=prv->next, pt=pt->next, i++);
 
-			if (i == ind) {
-				key = pt->key;
-				prv->next = pt->next;
-				free(pt);
-			}
-		}
-	}
+/** 
+ * Returns the rank of the combination in the combinatorial number system (combinadic). The ranks of the 
+ * "comb" combinations of TOTAL_BALL balls are 0..C(TOTAL_BALL, comb)-1, so they index dense counter arrays.
+ * 
+ * @param {Integer *} keys : keys (ball numbers) of the combination, sorted from smallest to greater
+ * @param {Integer} comb   : number of keys
+ * @return {Long}          : rank of the combination
+ */
+long rankComb(int *keys, int comb);
 
-	return key;
-}
 
 
+/** 
+ * Returns the combination of the rank (inverse of rankComb)
+ * 
+ * @param {Long} rank      : rank of the combination
+ * @param {Integer} comb   : number of keys
+ * @param {Integer *} keys : the keys (ball numbers) are assigned to this address sorted from smallest to greater (terminated with '\0')
+ */
+void unrankComb(long rank, int comb, int *keys);
 
-int addItemByIndex(struct ListX *pl, int ind, int key)
-{
-	struct Item *right = NULL, *left = pl->head;
-	struct Item *pt = (struct Item *) malloc(sizeof(struct Item));
-	int i;
 
-	if(seqSearchX1(pl, key) >= 0) return 0;
 
-	pt->key = key;
+/** 
+ * Returns the ranks (rankComb) of every "comb" combination of the keys, in lexicographic order of the combinations. 
+ * The combinations are enumerated by the kernel of (count, comb) in combKernels, nested loops of fixed depth and 
+ * bounds generated by COMB_KERNEL, the rank of a combination is the rank of its prefix plus the binomial of its last key.
+ * 
+ * @param {Integer *} keys : keys (ball numbers), sorted from smallest to greater
+ * @param {Integer} count  : number of keys (at most MAX_DRAW_BALL)
+ * @param {Integer} comb   : number of keys in the combinations
+ * @param {Long *} ranks   : the ranks are assigned to this address (at most MAX_COMB_RANKS ranks)
+ * @return {Integer}       : number of the combinations, C(count, comb)
+ */
+int rankCombs(int *keys, int count, int comb, long *ranks);
 
-	if (left == NULL || ind == 0) {
-		pl->head = pt;
-		pt->next = left;
-	} else {
-		right = left->next;
 
-		for (i=1; i<ind; i++) {
-			if (left != NULL) left = left->next;
-			if (right != NULL) right = right->next;
-		}
 
-		if (left == NULL) return 0;
-		left->next = pt;
-		pt->next = right;
-	}
+/** 
+ * Pack the keys (ball numbers) of a combination into a word, first key in the highest byte 
+ * (packed combinations of sorted keys are in lexicographic order)
+ * 
+ * @param {Integer *} keys : keys (ball numbers) of the combination
+ * @param {Integer} comb   : number of keys (at most 4)
+ * @return {unsigned long} : packed combination
+ */
+unsigned long packComb(int *keys, int comb);
 
-	return 1;
-}
 
 
+/** 
+ * Unpack a packed combination
+ * 
+ * @param {unsigned long} key : packed combination
+ * @param {Integer} comb      : number of keys
+ * @param {Integer *} keys    : the keys (ball numbers) are assigned to this address (terminated with '\0')
+ */
+void unpackComb(unsigned long key, int comb, int *keys);
 
-void removeAllX(struct ListX *pl)
-{
-	struct Item *prv, *pt = pl->head;
 
-	while (pt != NULL) {
-		prv = pt;
-		pt = pt->next;
-		free(prv);
-	} 
 
-	pl->head = NULL;
-}
+/** 
+ * Returns the slot of the combination in the hash table (the slot containing the combination or the empty slot to put it)
+ * 
+ * @param {unsigned long *} keys : packed combinations of the hash table (0 if the slot is empty)
+ * @param {Integer} size         : number of slots (power of 2)
+ * @param {unsigned long} key    : packed combination
+ * @return {Integer}             : index of the slot
+ */
+int combSlot(unsigned long *keys, int size, unsigned long key);
 
 
 
-void removeAllXY(struct ListXY *pl)
-{
-	struct ListX *prvList, *pList = pl->list;
+/** 
+ * Count a draw containing the combination
+ * 
+ * @param {struct CombCount *} pc : refers to the occurrence of the combination
+ * @param {Integer} drawIndex     : index of the draw in the drawn balls history
+ */
+void countComb(struct CombCount *pc, int drawIndex);
 
-	while (pList != NULL) {
-		prvList = pList;
-		pList = pList->next;
-		removeAllX(prvList);
-		free(prvList);
-	} 
-
-	pl->list = NULL;
-}
 
 
+/** 
+ * Compare function (for qsort) of the lucky numbers. Sorts by the first and second draw containing the combination, 
+ * then by the combination (the order in which the draws are compared with each other)
+ * 
+ * @param {const void *} a : refers to a lucky numbers entry
+ * @param {const void *} b : refers to a lucky numbers entry
+ * @return {Integer}       : negative, zero or positive
+ */
+int compareLucky(const void *a, const void *b);
 
-int length(struct ListX *pl)
-{
-	struct Item *tmp = pl->head;
-	int i=0;
 
-	while (tmp)
-	{
-		i++;
-		tmp = tmp->next;
-	}
 
-	return i;
-}
+/** 
+ * Create Empty combination filter (combinations of the drawn balls history or of a coupon)
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ * @param {Integer} bitsComb       : combinations up to bitsComb keys are kept in bitsets (1..FILTER_BITS_COMB)
+ * @return {struct CombFilter *}   : refers to the combination filter (memory allocated)
+ */
+struct CombFilter *createCombFilter(struct CombFilter *pf, int bitsComb);
 
 
 
-int lengthY(struct ListXY *pl)
-{
-	struct ListX *tmp = pl->list;
-	int i=0;
+/** 
+ * Free the combination filter
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ */
+void freeCombFilter(struct CombFilter *pf);
 
-	while (tmp)
-	{
-		i++;
-		tmp = tmp->next;
-	}
 
-	return i;
-}
 
+/** 
+ * Add the 2..DRAW_BALL combinations of a draw of the drawn balls history to the combination filter
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ * @param {unsigned char *} row    : refers to a row of the drawn balls history (DRAW_BALL balls)
+ */
+void addCombFilter(struct CombFilter *pf, unsigned char *row);
 
 
-int seqSearchX1(struct ListX *pl, int key)
-{
-	struct Item *t=pl->head;
-	int i=0;
 
-	while ( (t) && (t->key!=key) ) {
-		t=t->next;
-		i++;
-	}
+/** 
+ * Add the 1..count combinations of the keys to the combination filter
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ * @param {Integer *} keys         : keys (ball numbers), sorted from smallest to greater
+ * @param {Integer} count          : number of keys (at most DRAW_BALL)
+ */
+void addCombKeys(struct CombFilter *pf, int *keys, int count);
 
-	if (t) return i;
-	else return -1;
-}
 
 
+/** 
+ * Add the combinations of a list (first DRAW_BALL balls) to the combination filter
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ * @param {struct ListX *} pl      : refers to a list (a row of a coupon)
+ */
+void addCombList(struct CombFilter *pf, struct ListX *pl);
 
-int seqSearchX2(struct ListX *pl, int key1, int key2)
-{
-	struct Item *t=pl->head;
-	int found=0;
-	int i=0;
 
-	while ( t ) 
-	{
-		if (t->key == key1 || t->key == key2) found++;
-		if (found == 2) break;
-		t=t->next;
-		i++;
-	}
 
-	if (t) return i;
-	else return -1;
-}
+/** 
+ * Returns the combination filter of a 2 dimensions list. It is created from the lists on first use, 
+ * then appendList keeps it up to date.
+ * 
+ * @param {struct ListXY *} pl   : refers to a 2 dimensions list (coupon)
+ * @return {struct CombFilter *} : refers to the combination filter of the list
+ */
+struct CombFilter *getListFilter(struct ListXY *pl);
 
 
 
-int seqSearchX3(struct ListX *pl, int key1, int key2, int key3)
-{
-	struct Item *t=pl->head;
-	int found=0;
-	int i=0;
+/** 
+ * Put a combination to the hash set of the combination filter
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ * @param {Integer} comb           : number of keys of the combination (bitsComb+1..DRAW_BALL)
+ * @param {unsigned long} key      : rank of the combination + 1
+ */
+void putCombFilter(struct CombFilter *pf, int comb, unsigned long key);
 
-	while ( t ) 
-	{
-		if (t->key == key1 || t->key == key2 || t->key == key3) found++;
-		if (found == 3) break;
-		t=t->next;
-		i++;
-	}
 
-	if (t) return i;
-	else return -1;
-}
 
+/** 
+ * Is any "comb" combination of the keys in the combination filter (drawn in a previous draw)?
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ * @param {Integer *} keys         : keys (ball numbers), sorted from smallest to greater
+ * @param {Integer} count          : number of keys
+ * @param {Integer} comb           : single, double, triple, quartet, quintuple or sextuple (1-DRAW_BALL) combinations
+ * @return {Integer}               : Returns 1 if found, 0 if not.
+ */
+int testCombFilter(struct CombFilter *pf, int *keys, int count, int comb);
 
 
-int seqSearchX4(struct ListX *pl, int key1, int key2, int key3, int key4)
-{
-	struct Item *t=pl->head;
-	int found=0;
-	int i=0;
 
-	while ( t ) 
-	{
-		if (t->key == key1 || t->key == key2 || t->key == key3 || t->key == key4) found++;
-		if (found == 4) break;
-		t=t->next;
-		i++;
-	}
+/** 
+ * Create Empty Bloom filter
+ * 
+ * @param {struct BloomFilter *} pb : refers to a Bloom filter
+ * @param {long} keyCount           : expected number of keys (BLOOM_BITS_PER_KEY bits per key)
+ * @return {struct BloomFilter *}   : refers to the Bloom filter (memory allocated)
+ */
+struct BloomFilter *createBloomFilter(struct BloomFilter *pb, long keyCount);
 
-	if (t) return i;
-	else return -1;
-}
 
 
+/** 
+ * Put a key to the Bloom filter
+ * 
+ * @param {struct BloomFilter *} pb : refers to a Bloom filter
+ * @param {unsigned long} key       : key (rank of the combination)
+ */
+void putBloomFilter(struct BloomFilter *pb, unsigned long key);
 
-int seqSearchX5(struct ListX *pl, int key1, int key2, int key3, int key4, int key5)
-{
-	struct Item *t=pl->head;
-	int found=0;
-	int i=0;
 
-	while ( t ) 
-	{
-		if (t->key == key1 || t->key == key2 || t->key == key3 || t->key == key4 || t->key == key5) found++;
-		if (found == 5) break;
-		t=t->next;
-		i++;
-	}
 
-	if (t) return i;
-	else return -1;
-}
+/** 
+ * May the key be in the Bloom filter? (counts the lookup)
+ * 
+ * @param {struct BloomFilter *} pb : refers to a Bloom filter
+ * @param {unsigned long} key       : key (rank of the combination)
+ * @return {Integer}                : Returns 0 if the key is not in the filter, 1 if it may be.
+ */
+int testBloomFilter(struct BloomFilter *pb, unsigned long key);
 
 
 
-int seqSearchX6(struct ListX *pl, int key1, int key2, int key3, int key4, int key5, int key6)
-{
-	struct Item *t=pl->head;
-	int found=0;
-	int i=0;
+/** 
+ * Get the word index and the bits of a key in a Bloom filter
+ * 
+ * @param {struct BloomFilter *} pb : refers to a Bloom filter
+ * @param {unsigned long} key       : key (rank of the combination)
+ * @param {unsigned long *} bits    : the bits of the key are assigned to this address
+ * @return {unsigned long}          : index of the word
+ */
+unsigned long bloomWord(struct BloomFilter *pb, unsigned long key, unsigned long *bits);
 
-	while ( t ) 
-	{
-		if (t->key == key1 || t->key == key2 || t->key == key3 || t->key == key4 || t->key == key5 || t->key == key6) found++;
-		if (found == 6) break;
-		t=t->next;
-		i++;
-	}
 
-	if (t) return i;
-	else return -1;
-}
 
+/** 
+ * Print the lookups and the false positive rate of the Bloom filters of the combination filter
+ * 
+ * @param {struct CombFilter *} pf : refers to a combination filter
+ */
+void printBloomStats(struct CombFilter *pf);
 
 
-int seqSearchXY1(struct ListXY *pl, int key)
-{
-	struct ListX *tmp = pl->list;
-	int i=0;
 
-	while (tmp)
-	{
-		if (seqSearchX1(tmp, key) >= 0) break;
-		tmp = tmp->next;
-		i++;
-	}
+/** 
+ * Sort the keys (ball numbers) from smallest to greater
+ * 
+ * @param {Integer *} keys : keys (ball numbers)
+ * @param {Integer} count  : number of keys
+ */
+void sortKeys(int *keys, int count);
 
-	if (tmp) return i;
-	else return -1;
-}
 
 
+/**
+ * Build the lucky numbers lists and the lucky partners of the balls of the lucky draws (once, they do not change 
+ * during the session). The partners are read from the counts of the double combinations by rank.
+ */
+void initLuckyDraw();
 
-int seqSearchXY2(struct ListXY *pl, int key1, int key2)
-{
-	struct ListX *tmp = pl->list;
-	int i=0;
 
-	while (tmp)
-	{
-		if (seqSearchX2(tmp, key1, key2) >= 0) break;
-		tmp = tmp->next;
-		i++;
-	}
 
-	if (tmp) return i;
-	else return -1;
-}
+/**
+ * Draw balls by lucky numbers (the numbers that love each other drawn together)
+ * 
+ * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
+ * @param {struct Arena *} pa         : refers to the arena the rows are allocated from
+ * @param {Integer} drawNum           : 1: lucky 3, 2: 2 of lucky3, 3: lucky 2
+ * @param {Integer} totalDrawCount    : Total draw count
+ * @param {struct Rng *} rng          : refers to the random number generator
+*/
+void drawBallsByLucky(struct ListXY *coupon, struct Arena *pa, int drawNum, int totalDrawCount, struct Rng *rng);
 
 
 
-int seqSearchXY3(struct ListXY *pl, int key1, int key2, int key3)
-{
-	struct ListX *tmp = pl->list;
-	int i=0;
+/**
+ * Draw balls
+ * 
+ * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
+ * @param {struct ListX *} ballStats  : refers to balls and the number of times each ball was drawn in previous draws.
+ * @param {struct Arena *} pa         : refers to the arena the rows are allocated from
+ * @param {Integer} totalDrawCount    : how many draws will be made
+ * @param {Integer} drawByDate		  : If 1 draw balls by date, if 0 don't draw balls by date.
+ * @param {Integer} drawByNorm		  : If 1 draw, if 0 don't draw.
+ * @param {Integer} drawByLeft		  : If 1 draw, if 0 don't draw.
+ * @param {Integer} drawByBlend1	  : If 1 draw, if 0 don't draw.
+ * @param {Integer} drawByBlend2	  : If 1 draw, if 0 don't draw.
+ * @param {Integer} drawBySide		  : If 1 draw, if 0 don't draw.
+ * @param {Integer} drawByRand		  : If 1 draw, if 0 don't draw.
+ * @param {Integer} drawByLucky		  : If 1 draw, if 0 don't draw.
+ * @param {struct Rng *} rng       : refers to the random number generator
+*/
+void drawBalls(struct ListXY *coupon, struct ListX *ballStats, struct Arena *pa, int totalDrawCount, int drawByDate, int drawByNorm, int drawByLeft, int drawByBlend1, int drawByBlend2, int drawBySide, int drawByRand, int drawByLucky, struct Rng *rng)
+;
 
-	while (tmp)
-	{
-		if (seqSearchX3(tmp, key1, key2, key3) >= 0) break;
-		tmp = tmp->next;
-		i++;
-	}
 
-	if (tmp) return i;
-	else return -1;
-}
 
+/**
+ * Draw bonus ball (SuperStar, PowerBall)
+ * 
+ * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
+ * @param {struct ListX *} ballStats  : refers to bonus balls and the number of times each ball was drawn in previous draws.
+ * @param {struct Arena *} pa         : refers to the arena the rows are allocated from
+ * @param {Integer} drawCount         : how many draws will be made
+ * @param {struct Rng *} rng          : refers to the random number generator
+*/
+void drawBonusBall(struct ListXY *coupon, struct ListX *ballStats, struct Arena *pa, int drawCount, struct Rng *rng);
 
 
-int seqSearchXY4(struct ListXY *pl, int key1, int key2, int key3, int key4)
-{
-	struct ListX *tmp = pl->list;
-	int i=0;
 
-	while (tmp)
-	{
-		if (seqSearchX4(tmp, key1, key2, key3, key4) >= 0) break;
-		tmp = tmp->next;
-		i++;
-	}
+/**
+ * Draw coupons in chunks of BATCH_CHUNK rows and write them to the output file as they are drawn (batch mode). 
+ * The chunks are drawn on threadCount worker threads (BATCH_ROUND chunks per thread at a time) and written in order. 
+ * The date rows are drawn once, in the first chunk. The drawn rows are released when they are written. A row written 
+ * in the last BATCH_WINDOW..2*BATCH_WINDOW rows (with unique, in the batch) is not written again, it is drawn again in 
+ * a later round. The batch stops when the strategies give few new rows.
+ * 
+ * @param {long} count          : how many coupons will be drawn
+ * @param {Integer} strategy    : draw strategies (STRATEGY_DATE | STRATEGY_NORM | ...)
+ * @param {Integer} unique      : 1: a row is written once in the batch (the ranks of every written row are kept), 
+ *                                0: once in the dedup window
+ * @param {FILE *} fp           : refers to output file
+ * @param {char *} fileName     : name of the output file (for the report)
+ * @param {struct Rng *} rng    : refers to the random number generator
+ * @return {Integer}            : Returns 1 if count coupons are written, 0 if the batch is stopped before
+*/
+int drawBatch(long count, int strategy, int unique, FILE *fp, char *fileName, struct Rng *rng);
 
-	if (tmp) return i;
-	else return -1;
-}
 
 
+/** 
+ * Worker of the batch mode. Draws the chunks of the work with the random number generator, the arena and the 
+ * ball stats of the work, so the threads do not share anything they change.
+ * 
+ * @param {void *} arg : refers to a draw work (struct DrawWork)
+ * @return {void *}    : NULL
+ */
+void *drawWorker(void *arg);
 
-void chgVal(struct ListX *pl, int ind, int val)
-{
-	struct Item *t=pl->head;
-	int i;
 
-	for (i=0; (t) && i<ind; i++) {
-		t=t->next;
-	}
 
-	t->val = val;
-}
+/** 
+ * Write the rows of a coupon to the output file (numbered from first). The rows already in the filters of 
+ * the written rows are skipped, the others are put into the first one.
+ * 
+ * @param {struct ListXY *} coupon    : refers to the 2 dimensions balls list (coupon)
+ * @param {struct ListXY *} coupon_bonus : refers to the 2 dimensions balls list (bonus balls), NULL if the game has no bonus ball
+ * @param {long} first                : number of the first row
+ * @param {struct CombFilter *} written : refers to the combination filter of the written rows (NULL: every row is written)
+ * @param {struct CombFilter *} older : refers to the combination filter of the rows written before them (NULL if none)
+ * @param {FILE *} fp                 : refers to output file
+ * @return {long}                     : number of the next row
+ */
+long writeCoupon(struct ListXY *coupon, struct ListXY *coupon_bonus, long first, struct CombFilter *written, struct CombFilter *older, FILE *fp);
 
 
 
-void chgValXY(struct ListXY *pl, int ind, int val)
-{
-	struct ListX *tmp = pl->list;
-	int i;
+/** 
+ * Get drawn balls from file has been drawn so far. The file is mapped into memory and parsed in one pass, the rows are 
+ * appended to the history as they are decoded. A malformed row is reported with its line and column and skipped.
+ * 
+ * @param {struct DrawHistory *} : refers to the drawn balls history (rows are appended)
+ * @param {char *}               : Drawn list file
+ * @return {Integer}             : Returns 0 if the file is not found, 1 otherwise
+ */
+int getDrawnBallsList(struct DrawHistory *history, char *fileName);
 
-	for (i=0; (tmp) && i<ind; i++) {
-		tmp=tmp->next;
-	}
 
-	tmp->val = val;
-}
 
+/** 
+ * Parse a row (line) of the statistics file: the date, the winning numbers and the extra columns of the game, 
+ * separated with tabs or spaces
+ * 
+ * @param {char *} line        : first char of the line
+ * @param {char *} end         : end of the line (the newline or the end of the file)
+ * @param {Long *} date        : drawn date is assigned to this address (yyyymmdd)
+ * @param {Integer *} columns  : the numbers after the date are assigned to this address (DRAW_BALL + game.extraColumns)
+ * @param {char **} errorAt    : if the row is malformed, the position of the error is assigned to this address
+ * @param {char *} error       : if the row is malformed, the error message is assigned to this address (at least 80 chars)
+ * @return {Integer}           : Returns 1 if the row is parsed, 0 if it is malformed
+ */
+int parseDrawLine(char *line, char *end, long *date, int *columns, char **errorAt, char *error);
 
 
-void incVal(struct ListX *pl, int ind)
-{
-	struct Item *t=pl->head;
-	int i;
 
-	for (i=0; (t) && i<ind; i++) {
-		t=t->next;
-	}
+/** 
+ * Parse the decimal number at the position
+ * 
+ * @param {char *} p       : position of the number
+ * @param {char *} end     : end of the text
+ * @param {Long *} value   : the number is assigned to this address (numbers larger than 999999999 are 999999999)
+ * @return {char *}        : position after the number, NULL if there is no digit at the position
+ */
+char *parseNumber(char *p, char *end, long *value);
 
-	t->val++;
-}
 
 
+/** 
+ * Load the drawn balls history of the statistics file. The draws and the matched combination counts are read from 
+ * the binary history cache if it was written from the statistics file as it is now (same size and modification time), 
+ * otherwise the statistics file is parsed (the cache is written again by init, after the counts are calculated).
+ * 
+ * @param {struct DrawHistory *} history : refers to the drawn balls history (rows are appended)
+ * @param {char *} fileName              : statistics file
+ * @param {char *} cacheName             : binary history cache (NULL if it is not used)
+ * @return {Integer}                     : Returns 1 if the history is read from the cache, 0 if the statistics file is parsed, 
+ *                                         -1 if the statistics file is not found
+ */
+int loadDrawHistory(struct DrawHistory *history, char *fileName, char *cacheName);
 
-void incValXY(struct ListXY *pl, int ind)
-{
-	struct ListX *tmp = pl->list;
-	int i;
 
-	for (i=0; (tmp) && i<ind; i++) {
-		tmp=tmp->next;
-	}
 
-	tmp->val++;
-}
+/** 
+ * Read the drawn balls history and the matched combination counts (match2comb, ..) from the binary history cache 
+ * (memory mapped)
+ * 
+ * @param {struct DrawHistory *} history : refers to the drawn balls history (rows are appended)
+ * @param {char *} fileName              : statistics file (its size and modification time must be the ones in the cache)
+ * @param {char *} cacheName             : binary history cache
+ * @return {Integer}                     : Returns 1 if the draws are read, 0 if the cache is missing, stale or damaged
+ */
+int readHistoryCache(struct DrawHistory *history, char *fileName, char *cacheName);
 
 
 
-int getVal(struct ListX *pl, int ind)
-{
-	struct Item *t=pl->head;
-	int i;
+/** 
+ * Write the drawn balls history and the matched combination counts (match2comb, ..) to the binary history cache. 
+ * Nothing is written if the directory is read only or a date of the history is not a valid date (the days would 
+ * not give the same date back).
+ * 
+ * @param {struct DrawHistory *} history : refers to the drawn balls history
+ * @param {char *} fileName              : statistics file the history is read from (its size and modification time are kept)
+ * @param {char *} cacheName             : binary history cache
+ */
+void writeHistoryCache(struct DrawHistory *history, char *fileName, char *cacheName);
 
-	for (i=0; (t) && i<ind; i++) {
-		t=t->next;
-	}
 
-	return t->val;
-}
 
+/** 
+ * Map a file into memory read only (mmap, or read into an allocated buffer where mmap is not available)
+ * 
+ * @param {char *} fileName : file name
+ * @param {long *} size     : size of the file is assigned to this address
+ * @return {char *}         : contents of the file, NULL if it cannot be read or it is empty
+ */
+char *mapFile(char *fileName, long *size);
 
 
-int getValXY(struct ListXY *pl, int ind)
-{
-	struct ListX *tmp = pl->list;
-	int i;
 
-	for (i=0; (tmp) && i<ind; i++) {
-		tmp=tmp->next;
-	}
+/** 
+ * Release a file mapped with mapFile
+ * 
+ * @param {char *} data : contents of the file
+ * @param {long} size   : size of the file
+ */
+void unmapFile(char *data, long size);
 
-	return tmp->val;
-}
 
 
+/** 
+ * Build the 2 dimensions lists (list view) of the drawn balls history. The program works on the history itself, 
+ * the view is not built at load.
+ * 
+ * @param {struct DrawHistory *} : refers to the drawn balls history
+ * @param {struct ListXY *}      : refer to 2 dimensions list of winning numbers
+ * @param {struct ListXY *}      : refer to 2 dimensions list of bonus numbers (SuperStar, PowerBall)
+ */
+void getDrawnBallsListXY(struct DrawHistory *history, struct ListXY * winningDrawnBallsList, struct ListXY * bonusDrawnBallsList);
 
-int getKey(struct ListX *pl, int index)
-{
-	struct Item *t=pl->head;
-	int i;
 
-	for (i=0; (t) && i<index; i++) {
-		t=t->next;
-	}
 
-	return t->key;
-}
+/** 
+ * Create Empty drawn balls history
+ * 
+ * @param {struct DrawHistory *} : refers to a drawn balls history
+ * @return {struct DrawHistory *}: refers to the drawn balls history (memory allocated)
+ */
+struct DrawHistory *createDrawHistory(struct DrawHistory *ph);
 
 
 
-void getKeys(struct ListX *pl, int *keys, int index, int count)
-{
-	struct Item *t=pl->head;
-	int i;
+/** 
+ * Add a draw (row) to the end of the drawn balls history
+ * 
+ * @param {struct DrawHistory *} ph : refers to a drawn balls history
+ * @param {Integer *} keys          : winning numbers of the draw (DRAW_BALL keys)
+ * @param {Integer} bonusBall       : bonus number of the draw (0 if the game has no bonus ball)
+ * @param {Long} date               : drawn date (yyyymmdd)
+ */
+void appendDraw(struct DrawHistory *ph, int *keys, int bonusBall, long date);
 
-	for (i=0; (t) && i<index; i++) {
-		t=t->next;
-	}
 
-	for (i=0; (t) && i<count; i++) {
-		keys[i] = t->key;
-		t=t->next;
-	}
 
-	keys[i] = '\0';
-}
+/** 
+ * Add a draw (row) to the top of the drawn balls history (the latest draw, index 0)
+ * 
+ * @param {struct DrawHistory *} ph : refers to a drawn balls history
+ * @param {Integer *} keys          : winning numbers of the draw (DRAW_BALL keys)
+ * @param {Integer} bonusBall       : bonus number of the draw (0 if the game has no bonus ball)
+ * @param {Long} date               : drawn date (yyyymmdd)
+ */
+void prependDraw(struct DrawHistory *ph, int *keys, int bonusBall, long date);
 
 
 
-struct ListX * getListXByIndex(struct ListXY *pl, int ind)
-{
-	struct ListX *l = pl->list;
-	int i;
+/** 
+ * Returns the keys (ball numbers) of the row of the drawn balls history
+ * 
+ * @param {unsigned char *} row : refers to a row (DRAW_BALL balls)
+ * @param {Integer *} keys      : the keys (ball numbers) are assigned to this address (terminated with '\0')
+ */
+void getRowKeys(unsigned char *row, int *keys);
 
-	for (i=0; (l) && i<ind; i++) {
-		l = l->next;
-	}
 
-	return l;
-}
 
+/** 
+ * Print keys (ball numbers) of the row of the drawn balls history
+ * 
+ * @param {unsigned char *} row : refers to a row (DRAW_BALL balls)
+ * @param {Integer} printTo     : 0 = print to screen and output file, 1 = print to screen only, 2 = print to output file only
+ * @param {FILE *} fp           : refers to output file
+ */
+void printRowByKey(unsigned char *row, int printTo, FILE *fp);
 
 
-void bubbleSortXByVal(struct ListX *pl, int inc)
-{
-	int swapped, i;
-	struct Item *ptr1;
-	struct Item *lptr = NULL;
 
-	if (pl->head == NULL) return;
+/** 
+ * Pack a date as yyyymmdd
+ * 
+ * @param {Integer} d  : day
+ * @param {Integer} m  : month
+ * @param {Integer} y  : year
+ * @return {Long}      : packed date (yyyymmdd)
+ */
+long packDate(int d, int m, int y);
 
-	do {
-		swapped = 0;
-		ptr1 = pl->head;
 
-		while (ptr1->next != lptr)
-		{
-			if (inc == 1) {
-				if (ptr1->val > ptr1->next->val) {
-					swapX(ptr1, ptr1->next);
-					swapped = 1;
-				}
-			} else if (inc == -1) {
-				if (ptr1->val < ptr1->next->val) {
-					swapX(ptr1, ptr1->next);
-					swapped = 1;
-				}
-			}
-			ptr1 = ptr1->next;
-		}
-		lptr = ptr1;
-	} while (swapped);
-}
 
+/** 
+ * Unpack a date packed with packDate
+ * 
+ * @param {Long} date   : packed date (yyyymmdd)
+ * @param {Integer *} d : day
+ * @param {Integer *} m : month
+ * @param {Integer *} y : year
+ */
+void unpackDate(long date, int *d, int *m, int *y);
 
 
-void bubbleSortYByVal(struct ListXY *pl, int inc)
-{
-	int swapped, i;
-	struct ListX *ptr1;
-	struct ListX *lptr = NULL;
 
-	if (pl->list == NULL) return;
+/** 
+ * Format a date packed with packDate as dd.mm.yyyy
+ * 
+ * @param {Long} date   : packed date (yyyymmdd)
+ * @param {char *} str  : the date string is assigned to this address (at least 11 chars)
+ */
+void formatDate(long date, char *str);
 
-	do {
-		swapped = 0;
-		ptr1 = pl->list;
 
-		while (ptr1->next != lptr)
-		{
-			if (inc == 1) {
-				if (ptr1->val > ptr1->next->val) {
-					swapY(ptr1, ptr1->next);
-					swapped = 1;
-				}
-			} else if (inc == -1) {
-				if (ptr1->val < ptr1->next->val) {
-					swapY(ptr1, ptr1->next);
-					swapped = 1;
-				}
-			}
-			ptr1 = ptr1->next;
-		}
-		lptr = ptr1;
-	} while (swapped);
-}
 
+/** 
+ * Returns the day number of a date packed with packDate (days from 1 March of the year 0, the same count as dateDiff)
+ * 
+ * @param {Long} date   : packed date (yyyymmdd)
+ * @return {Long}       : day number
+ */
+long dayNumber(long date);
 
 
-void bubbleSortXByKey(struct ListX *pl)
-{
-	int swapped, i;
-	struct Item *ptr1;
-	struct Item *lptr = NULL;
 
-	if (pl->head == NULL) return;
+/** 
+ * Returns the date of a day number (inverse of dayNumber)
+ * 
+ * @param {Long} day    : day number
+ * @return {Long}       : packed date (yyyymmdd)
+ */
+long dayDate(long day);
 
-	do {
-		swapped = 0;
-		ptr1 = pl->head;
 
-		while (ptr1->next != lptr)
-		{
-			if (ptr1->key > ptr1->next->key) {
-				swapX(ptr1, ptr1->next);
-				swapped = 1;
-			}
-			ptr1 = ptr1->next;
-		}
-		lptr = ptr1;
-	} while (swapped);
-}
 
+/* FUNCTIONS */
 
 
-void swapX(struct Item *a, struct Item *b)
+struct ListX *createListX(struct ListX *pl, char *date, char *label, int val)
 {
-	int temp;
-
-	temp = a->key;
-	a->key = b->key;
-	b->key = temp;
-
-	temp = a->val;
-	a->val = b->val;
-	b->val = temp;
+	pl = createListXIn(NULL, date, label, val);
+	return pl;
 }
 
 
 
-void swapY(struct ListX *a, struct ListX *b)
+struct ListX *createListXIn(struct Arena *pa, char *date, char *label, int val)
 {
-	struct Item *head;
-	char *date;
-	char *label;
-	int val;
+	struct ListX *pl = NULL;
 
-	val = a->val;
-	a->val = b->val;
-	b->val = val;
+	if (pa == NULL) {
+		pl = (struct ListX *) malloc(sizeof(struct ListX));
+	} else if (pa->freeLists) {
+		pl = pa->freeLists;
+		pa->freeLists = pl->next;
+	} else {
+		pl = (struct ListX *) arenaAlloc(pa, sizeof(struct ListX));
+	}
 
-	date = a->date;
-	a->date = b->date;
-	b->date = date;
+	pl->head = NULL;
+	pl->next = NULL;
+	pl->arena = pa;
 
-	label = a->label;
-	a->label = b->label;
-	b->label = label;
+	if (date) {
+		pl->date = (char *) ((pa) ? arenaAlloc(pa, sizeof(char)*11) : malloc(sizeof(char)*11));
+		strcpy(pl->date, date);
+	} else {
+		pl->date = NULL;
+	}
 
-	head = b->head;
-	b->head = a->head;
-	a->head = head;
+	if (label) {
+		pl->label = (char *) ((pa) ? arenaAlloc(pa, sizeof(char)*30) : malloc(sizeof(char)*30));
+		strcpy(pl->label, label);
+	} else {
+		pl->label = NULL;
+	}
+
+	pl->val = val;
+	return pl;
 }
 
 
 
-void printListXByKey(struct ListX *pl, int printTo, FILE *fp)
+struct ListX *copyListX(struct ListX *pl)
 {
-	struct Item *t=pl->head;
+	struct ListX *copy = NULL;
+	struct Item *pt, *item, *tail = NULL;
 
-	while (t) {
-		if (printTo == 0) { // print to screen and output file
-			printf("%2d ", t->key);
-			fprintf(fp, "%2d ", t->key);
-		} else if (printTo == 1) { // print to screen only
-			printf("%2d ", t->key);
-		} else if (printTo == 2) { // print to output file only
-			fprintf(fp, "%2d ", t->key);
-		}
-		t=t->next;
-	}
-}
+	copy = createListX(copy, pl->date, pl->label, pl->val);
 
+	for (pt = pl->head; (pt); pt = pt->next) 
+	{
+		item = newItem(copy, pt->key);
+		item->val = pt->val;
 
+		if (tail) tail->next = item;
+		else copy->head = item;
 
-void printListXYByKey(struct ListXY *pl, FILE *fp)
-{
-	struct ListX *nl = pl->list;
-	struct Item *pt = nl->head;
-	int i;
-
-	printf("     Numbers\n\n");
-
-	if (fp != NULL) fprintf(fp, "     Numbers\n\n");
-
-	for (i=1; (nl); i++) 
-	{
-		printf("%2d - ", i);
+		tail = item;
+	}
 
-		if (fp != NULL) fprintf(fp, "%2d - ", i);
+	return copy;
+}
 
-		while (pt) 
-		{
-			printf("%2d ", pt->key);
-			if (fp != NULL) fprintf(fp, "%2d ", pt->key);
-			pt = pt->next;
-		}
 
-		if (nl->label) {
-			printf("  %s", nl->label);
-			if (fp != NULL) fprintf(fp, "  %s", nl->label);
-		}
 
-		nl = nl->next;
-		if (nl != NULL) pt = nl->head;
-		printf("\n");
-		if (fp != NULL) fprintf(fp, "\n");
-	}
+struct Arena *createArena(struct Arena *pa)
+{
+	pa = (struct Arena *) malloc(sizeof(struct Arena));
+	pa->block = NULL;
+	pa->freeItems = NULL;
+	pa->freeLists = NULL;
+	return pa;
 }
 
 
 
-void printListXYWithSSByKey(struct ListXY *pl1, struct ListXY *pl2, FILE *fp)
+void *arenaAlloc(struct Arena *pa, size_t size)
 {
-	struct ListX *nl1 = pl1->list;
-	struct ListX *nl2 = pl2->list;
-	struct Item *pt1 = nl1->head;
-	struct Item *pt2 = nl2->head;
-	int i;
+	struct ArenaBlock *pb = pa->block;
+	size_t header = (sizeof(struct ArenaBlock) + ARENA_ALIGN-1) / ARENA_ALIGN * ARENA_ALIGN;
+	void *p;
 
-	printf("     Numbers          SuperStar\n\n");
-	if (fp != NULL) fprintf(fp, "     Numbers          SuperStar\n\n");
+	size = (size + ARENA_ALIGN-1) / ARENA_ALIGN * ARENA_ALIGN;
 
-	for (i=1; (nl1) && (nl2); i++) 
+	if (pb == NULL || pb->used + size > pb->size) 
 	{
-		printf("%2d - ", i);
-		if (fp != NULL) fprintf(fp, "%2d - ", i);
-
-		while (pt1) {
-			printf("%2d ", pt1->key);
-			if (fp != NULL) fprintf(fp, "%2d ", pt1->key);
-			pt1 = pt1->next;
-		}
-
-		printf("  %2d ", pt2->key);
-		if (fp != NULL) fprintf(fp, "  %2d ", pt2->key);
-
-		if (nl1->label) {
-			printf("     %s", nl1->label);
-			if (fp != NULL) fprintf(fp, "     %s", nl1->label);
-		}
-
-		nl1 = nl1->next;
-		nl2 = nl2->next;
+		pb = (struct ArenaBlock *) malloc((header + size > ARENA_BLOCK) ? header + size : ARENA_BLOCK);
+		pb->size = (header + size > ARENA_BLOCK) ? header + size : ARENA_BLOCK;
+		pb->used = header;
+		pb->next = pa->block;
+		pa->block = pb;
+	}
 
-		if (nl1 != NULL && nl2 != NULL) {
-			pt1 = nl1->head;
-			pt2 = nl2->head;
-		}
+	p = (char *) pb + pb->used;
+	pb->used += size;
 
-		printf("\n");
-		if (fp != NULL) fprintf(fp, "\n");
-	}
+	return p;
 }
 
 
 
-void printBallStats(struct ListX *ballStats)
+void releaseArena(struct Arena *pa)
 {
-	struct Item *t = ballStats->head;
-	int i = 0;
-
-#ifdef __MSDOS__
-	int col = 10;
-#else
-	int col = 15;
-#endif
+	struct ArenaBlock *prv, *pb = pa->block;
 
-	while (t) {
-		printf("%2d:%3d", t->key, t->val);
-		if ((i+1) % col == 0) printf("\n");
-		else printf("  ");
-		t=t->next;
-		i++;
+	while (pb != NULL) {
+		prv = pb;
+		pb = pb->next;
+		free(prv);
 	}
+
+	pa->block = NULL;
+	pa->freeItems = NULL;
+	pa->freeLists = NULL;
 }
 
 
 
-void printLuckyBalls(struct ListXY *pl, FILE *fp)
+struct Item *newItem(struct ListX *pl, int key)
 {
-	struct ListX *nl = pl->list;
-	struct Item *pt = nl->head;
-	int i = 0;
-	int len = length(nl);
+	struct Item *pt = NULL;
+	struct Arena *pa = pl->arena;
+
+	if (pa == NULL) {
+		pt = (struct Item *) malloc(sizeof(struct Item));
+	} else if (pa->freeItems) {
+		pt = pa->freeItems;
+		pa->freeItems = pt->next;
+	} else {
+		pt = (struct Item *) arenaAlloc(pa, sizeof(struct Item));
+	}
 
-#ifdef __MSDOS__
-	int col = 6-len;
-#else
-	int col = 8-len;
-#endif
+	pt->key = key;
+	pt->next = NULL;
 
-	while (nl)
-	{
-		while (pt) {
-			printf("%2d ", pt->key);
-			if (fp != NULL) fprintf(fp, "%2d ", pt->key);
-			pt = pt->next;
-		}
+	return pt;
+}
 
-		printf(": %2d times", numberOfTerm(nl->val)+1);
-		if (fp != NULL) fprintf(fp, ": %2d times", numberOfTerm(nl->val)+1);
 
-		if ((i+1) % col == 0) {
-			printf("\n");
-			if (fp != NULL) fprintf(fp, "\n");
-		} else {
-			printf("    ");
-			if (fp != NULL) fprintf(fp, "    ");
-		}
 
-		i++;
-		nl = nl->next;
-		if (nl != NULL) pt = nl->head;
+void freeItem(struct ListX *pl, struct Item *pt)
+{
+	if (pl->arena == NULL) {
+		free(pt);
+	} else {
+		pt->next = pl->arena->freeItems;
+		pl->arena->freeItems = pt;
 	}
-	printf("\n");
 }
 
 
 
-int numberOfTerm(int sum)
+void freeListX(struct ListX *pl)
 {
-	int n;
+	removeAllX(pl);
 
-	for (n=0; sum>0; n++) {
-		sum = sum - (n+1);
+	if (pl->arena == NULL) {
+		free(pl->date);
+		free(pl->label);
+		free(pl);
+	} else {
+		pl->next = pl->arena->freeLists;
+		pl->arena->freeLists = pl;
 	}
-
-	return n;
 }
 
 
 
-int gaussIndex(int ballCount)
+struct ListXY *createListXY(struct ListXY *pl)
 {
-	int node=0, leftnode=0, level;
+	pl = (struct ListXY *) malloc(sizeof(struct ListXY));
+	pl->list = NULL;
+	pl->tail = NULL;
+	pl->index = NULL;
+	pl->length = 0;
+	pl->size = 0;
+	pl->filter = NULL;
+	return pl;
+}
 
-	for (level=1; level<ballCount;)
-	{
-		if (rand() % 100 < 49 + rand() % 2)
-			node = node + level;
-		else
-			node = node + level + 1;
 
-		leftnode = leftnode + level;
-		level++;
-	}
 
-	return node - (leftnode-1);
+void insertItem(struct ListX *pl, int key)
+{
+	struct Item *pt = newItem(pl, key);
+	pt->next = pl->head;
+	pl->head = pt;
 }
 
 
 
-int findComb(struct ListX *drawnBalls, int comb)
+struct Item *atEnd(struct ListX *pl)
 {
-	int found = 0;
+	struct Item *curr;
 
-	switch (comb)
-	{
-	case 2 : found = search2CombXY(winningDrawnBallsList, drawnBalls); break;
-	case 3 : found = search3CombXY(winningDrawnBallsList, drawnBalls); break;
-	case 4 : found = search4CombXY(winningDrawnBallsList, drawnBalls); break;
-	case 5 : found = search5CombXY(winningDrawnBallsList, drawnBalls); break;
-	case 6 : found = search6CombXY(winningDrawnBallsList, drawnBalls); break;
-	default: break;
-	}
+	if (pl->head == NULL)
+		return NULL;
 
-	return found;
+	curr = pl->head;
+
+	while (curr->next)
+		curr = curr->next;
+
+	return curr;
 }
 
 
 
-int search6CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+struct ListX *atEndY(struct ListXY *pl)
 {
-	int i;
-	int b1, b2, b3, b4, b5, b6;
-	int keys[DRAW_BALL+1];
-	struct ListX *aPrvDrawn = NULL;
-	int found = 0;
+	if (pl == NULL)
+		return NULL;
 
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	return pl->tail;
+}
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
 
-	for (i=0; i<lengthY(prvDrawnsList); i++) 
-	{
-		aPrvDrawn = getListXByIndex(prvDrawnsList, i);
 
-		if (seqSearchX6(aPrvDrawn, b1, b2, b3, b4, b5, b6) >= 0) {found=1; break;}
-	}
+void appendItem(struct ListX *pl, int key)
+{
+	struct Item *pt = newItem(pl, key);
 
-	return found;
+	if (pl->head == NULL)
+		pl->head = pt;
+	else
+		(atEnd(pl))->next = pt;
 }
 
 
 
-int search6CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls)
+void appendItems(struct ListX *pl, int *keys)
 {
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	int found = 0;
-
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	int i;
+	struct Item *pt[MAX_DRAW_BALL];
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	for (i=0; keys[i] != '\0'; i++) {
+		pt[i] = newItem(pl, keys[i]);
+		if (i>0) pt[i-1]->next = pt[i];
+	}
 
-	if (seqSearchX6(aPrvDrawn, b1, b2, b3, b4, b5, b6) >= 0) found=1;
+	pt[i-1]->next = NULL;
 
-	return found;
+	if (pl->head == NULL)
+		pl->head = pt[0];
+	else
+		(atEnd(pl))->next = pt[0];
 }
 
 
 
-int search5CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+void appendList(struct ListXY *pl, struct ListX *plNext)
 {
-	int i;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	struct ListX *aPrvDrawn = NULL;
-	int found = 0;
+	if (pl == NULL) return;
 
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	if (pl->length == pl->size) {
+		pl->size = pl->size ? pl->size*2 : 16;
+		pl->index = (struct ListX **) realloc(pl->index, sizeof(struct ListX *)*pl->size);
+	}
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	plNext->next = NULL;
 
-	for (i=0; i<lengthY(prvDrawnsList); i++) 
-	{
-		aPrvDrawn = getListXByIndex(prvDrawnsList, i);
+	if (pl->list == NULL)
+		pl->list = plNext;
+	else
+		pl->tail->next = plNext;
 
-		if (seqSearchX5(aPrvDrawn, b1, b2, b3, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX5(aPrvDrawn, b1, b2, b3, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX5(aPrvDrawn, b1, b2, b3, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX5(aPrvDrawn, b1, b2, b4, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX5(aPrvDrawn, b1, b3, b4, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX5(aPrvDrawn, b2, b3, b4, b5, b6) >= 0) {found=1; break;}
-	}
+	pl->tail = plNext;
+	pl->index[pl->length++] = plNext;
 
-	return found;
+	if (pl->filter) addCombList(pl->filter, plNext);
 }
 
 
 
-int search5CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, char *buf)
+void removeItemByKey(struct ListX *pl, int key)
 {
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	int found = 0;
-	char fStr[20];
-
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
-
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	struct Item *prv, *pt = pl->head;
 
-	if (buf) buf[0] = '\0';
+	if (pt) {
+		if (pt->key == key) {
+			pl->head = pt->next;
+			freeItem(pl, pt);
+		} else {
+			for (prv=pt, pt=pt->next; ((pt) && (pt->key != key)); prv=prv->next, pt=pt->next);
 
-	if (seqSearchX5(aPrvDrawn, b1, b2, b3, b4, b5) >= 0)
-	{
-		if (buf) {
-			sprintf(fStr, "(%2d,%2d,%2d,%2d,%2d)", b1, b2, b3, b4, b5);
-			strcat(buf, fStr);
+			if (pt->key == key) {
+				prv->next = pt->next;
+				freeItem(pl, pt);
+			}
 		}
-		found=1;
 	}
+}
 
-	if (seqSearchX5(aPrvDrawn, b1, b2, b3, b4, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d,%2d)", b1, b2, b3, b4, b6);
-			strcat(buf, fStr);
-		}
-		found=1;
-	}
 
-	if (seqSearchX5(aPrvDrawn, b1, b2, b3, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d,%2d)", b1, b2, b3, b5, b6);
-			strcat(buf, fStr);
-		}
-		found=1;
-	}
 
-	if (seqSearchX5(aPrvDrawn, b1, b2, b4, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d,%2d)", b1, b2, b4, b5, b6);
-			strcat(buf, fStr);
-		}
-		found=1;
-	}
+int removeItemByIndex(struct ListX *pl, int ind)
+{
+	struct Item *prv, *pt = pl->head;
+	int i, key = 0;
 
-	if (seqSearchX5(aPrvDrawn, b1, b3, b4, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d,%2d)", b1, b3, b4, b5, b6);
-			strcat(buf, fStr);
-		}
-		found=1;
-	}
+	if (pt) {
+		if (ind == 0) {
+			key = pt->key;
+			pl->head = pt->next;
+			freeItem(pl, pt);
+		} else {
+			for (i=1, prv=pt, pt=pt->next; (pt) && (i<ind); prv=prv->next, pt=pt->next, i++);
 
-	if (seqSearchX5(aPrvDrawn, b2, b3, b4, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d,%2d)", b2, b3, b4, b5, b6);
-			strcat(buf, fStr);
+			if (i == ind) {
+				key = pt->key;
+				prv->next = pt->next;
+				freeItem(pl, pt);
+			}
 		}
-		found=1;
 	}
 
-	return found;
+	return key;
 }
 
 
 
-int search4CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+int addItemByIndex(struct ListX *pl, int ind, int key)
 {
+	struct Item *right = NULL, *left = pl->head;
+	struct Item *pt = NULL;
 	int i;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	struct ListX *aPrvDrawn = NULL;
-	int found = 0;
 
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	if(seqSearchX1(pl, key) >= 0) return 0;
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	pt = newItem(pl, key);
 
-	for (i=0; i<lengthY(prvDrawnsList); i++) 
-	{
-		aPrvDrawn = getListXByIndex(prvDrawnsList, i);
-
-		if (seqSearchX4(aPrvDrawn, b1, b2, b3, b4) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b2, b3, b5) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b2, b3, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b2, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b2, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b2, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b3, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b3, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b3, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b1, b4, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b2, b3, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b2, b3, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b2, b3, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b2, b4, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX4(aPrvDrawn, b3, b4, b5, b6) >= 0) {found=1; break;}
-	}
+	if (left == NULL || ind == 0) {
+		pl->head = pt;
+		pt->next = left;
+	} else {
+		right = left->next;
 
-	return found;
-}
+		for (i=1; i<ind; i++) {
+			if (left != NULL) left = left->next;
+			if (right != NULL) right = right->next;
+		}
 
+		if (left == NULL) {
+			freeItem(pl, pt);
+			return 0;
+		}
+		left->next = pt;
+		pt->next = right;
+	}
+
+	return 1;
+}
 
 
-int search4CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListXY *luckyBalls, char *buf)
+
+void removeAllX(struct ListX *pl)
 {
-	struct ListX *lb = NULL;
-	int index;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	int found = 0;
-	char fStr[20];
+	struct Item *prv, *pt = pl->head;
 
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	while (pt != NULL) {
+		prv = pt;
+		pt = pt->next;
+		freeItem(pl, prv);
+	} 
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	pl->head = NULL;
+}
 
-	if (buf) buf[0] = '\0';
 
-	if (seqSearchX4(aPrvDrawn, b1, b2, b3, b4) >= 0)
-	{
-		if (buf) {
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b2, b3, b4);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b2, b3, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b3;
-				keys[3] = b4;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+void removeAllXY(struct ListXY *pl)
+{
+	struct ListX *prvList, *pList = pl->list;
 
-	if (seqSearchX4(aPrvDrawn, b1, b2, b3, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b2, b3, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b2, b3, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b3;
-				keys[3] = b5;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+	while (pList != NULL) {
+		prvList = pList;
+		pList = pList->next;
+		freeListX(prvList);
+	} 
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+	free(pl->index);
 
-	if (seqSearchX4(aPrvDrawn, b1, b2, b3, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b2, b3, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b2, b3, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b3;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+	if (pl->filter) freeCombFilter(pl->filter);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+	pl->list = NULL;
+	pl->tail = NULL;
+	pl->index = NULL;
+	pl->length = 0;
+	pl->size = 0;
+	pl->filter = NULL;
+}
 
-	if (seqSearchX4(aPrvDrawn, b1, b2, b4, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b2, b4, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b2, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b4;
-				keys[3] = b5;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX4(aPrvDrawn, b1, b2, b4, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b2, b4, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b2, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b4;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+int length(struct ListX *pl)
+{
+	struct Item *tmp = pl->head;
+	int i=0;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+	while (tmp)
+	{
+		i++;
+		tmp = tmp->next;
 	}
 
-	if (seqSearchX4(aPrvDrawn, b1, b2, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b2, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b2, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b5;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+	return i;
+}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX4(aPrvDrawn, b1, b3, b4, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b3, b4, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b3, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = b4;
-				keys[3] = b5;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+int lengthY(struct ListXY *pl)
+{
+	return pl->length;
+}
 
-	if (seqSearchX4(aPrvDrawn, b1, b3, b4, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b3, b4, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b3, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = b4;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX4(aPrvDrawn, b1, b3, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b3, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b3, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = b5;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+int seqSearchX1(struct ListX *pl, int key)
+{
+	struct Item *t=pl->head;
+	int i=0;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+	while ( (t) && (t->key!=key) ) {
+		t=t->next;
+		i++;
 	}
 
-	if (seqSearchX4(aPrvDrawn, b1, b4, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b1, b4, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b1, b4, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b4;
-				keys[2] = b5;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+	if (t) return i;
+	else return -1;
+}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX4(aPrvDrawn, b2, b3, b4, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b2, b3, b4, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b2, b3, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = b4;
-				keys[3] = b5;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+int seqSearchX2(struct ListX *pl, int key1, int key2)
+{
+	struct Item *t=pl->head;
+	int found=0;
+	int i=0;
 
-	if (seqSearchX4(aPrvDrawn, b2, b3, b4, b6) >= 0)
+	while ( t ) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b2, b3, b4, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b2, b3, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = b4;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
-
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+		if (t->key == key1 || t->key == key2) found++;
+		if (found == 2) break;
+		t=t->next;
+		i++;
 	}
 
-	if (seqSearchX4(aPrvDrawn, b2, b3, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b2, b3, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b2, b3, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = b5;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
+	if (t) return i;
+	else return -1;
+}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX4(aPrvDrawn, b2, b4, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b2, b4, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b2, b4, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b2;
-				keys[1] = b4;
-				keys[2] = b5;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+int seqSearchX3(struct ListX *pl, int key1, int key2, int key3)
+{
+	struct Item *t=pl->head;
+	int found=0;
+	int i=0;
 
-	if (seqSearchX4(aPrvDrawn, b3, b4, b5, b6) >= 0)
+	while ( t ) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d,%2d)", b3, b4, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY4(luckyBalls, b3, b4, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b3;
-				keys[1] = b4;
-				keys[2] = b5;
-				keys[3] = b6;
-				keys[4] = '\0';
-		
-				appendItems(lb, keys);
-
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+		if (t->key == key1 || t->key == key2 || t->key == key3) found++;
+		if (found == 3) break;
+		t=t->next;
+		i++;
 	}
 
-	return found;
+	if (t) return i;
+	else return -1;
 }
 
 
 
-int search3CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+int seqSearchX4(struct ListX *pl, int key1, int key2, int key3, int key4)
 {
-	int i;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	struct ListX *aPrvDrawn = NULL;
-	int found = 0;
-
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
-
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	struct Item *t=pl->head;
+	int found=0;
+	int i=0;
 
-	for (i=0; i<lengthY(prvDrawnsList); i++) 
+	while ( t ) 
 	{
-		aPrvDrawn = getListXByIndex(prvDrawnsList, i);
-
-		if (seqSearchX3(aPrvDrawn, b1, b2, b3) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b2, b4) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b2, b5) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b2, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b3, b4) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b3, b5) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b3, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b1, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b2, b3, b4) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b2, b3, b5) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b2, b3, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b2, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b2, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b2, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b3, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b3, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b3, b5, b6) >= 0) {found=1; break;}
-		if (seqSearchX3(aPrvDrawn, b4, b5, b6) >= 0) {found=1; break;}
+		if (t->key == key1 || t->key == key2 || t->key == key3 || t->key == key4) found++;
+		if (found == 4) break;
+		t=t->next;
+		i++;
 	}
 
-	return found;
+	if (t) return i;
+	else return -1;
 }
 
 
 
-int search3CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListXY *luckyBalls, char *buf)
+int seqSearchX5(struct ListX *pl, int key1, int key2, int key3, int key4, int key5)
 {
-	struct ListX *lb = NULL;
-	int index;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	int found = 0;
-	char fStr[20];
+	struct Item *t=pl->head;
+	int found=0;
+	int i=0;
 
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	while ( t ) 
+	{
+		if (t->key == key1 || t->key == key2 || t->key == key3 || t->key == key4 || t->key == key5) found++;
+		if (found == 5) break;
+		t=t->next;
+		i++;
+	}
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+	if (t) return i;
+	else return -1;
+}
 
-	if (buf) buf[0] = '\0';
 
-	if (seqSearchX3(aPrvDrawn, b1, b2, b3) >= 0)
-	{
-		if (buf) {
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b2, b3);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b2, b3)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b3;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+int seqSearchX6(struct ListX *pl, int key1, int key2, int key3, int key4, int key5, int key6)
+{
+	struct Item *t=pl->head;
+	int found=0;
+	int i=0;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+	while ( t ) 
+	{
+		if (t->key == key1 || t->key == key2 || t->key == key3 || t->key == key4 || t->key == key5 || t->key == key6) found++;
+		if (found == 6) break;
+		t=t->next;
+		i++;
 	}
 
-	if (seqSearchX3(aPrvDrawn, b1, b2, b4) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b2, b4);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b2, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+	if (t) return i;
+	else return -1;
+}
 
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b4;
-				keys[3] = '\0';
+
+
+int seqSearchXY1(struct ListXY *pl, int key)
+{
+	struct ListX *tmp = pl->list;
+	int i=0;
+
+	while (tmp)
+	{
+		if (seqSearchX1(tmp, key) >= 0) break;
+		tmp = tmp->next;
+		i++;
+	}
+
+	if (tmp) return i;
+	else return -1;
+}
+
+
+
+int seqSearchXY2(struct ListXY *pl, int key1, int key2)
+{
+	struct ListX *tmp = pl->list;
+	int i=0;
+
+	while (tmp)
+	{
+		if (seqSearchX2(tmp, key1, key2) >= 0) break;
+		tmp = tmp->next;
+		i++;
+	}
+
+	if (tmp) return i;
+	else return -1;
+}
+
+
+
+int seqSearchXY3(struct ListXY *pl, int key1, int key2, int key3)
+{
+	struct ListX *tmp = pl->list;
+	int i=0;
+
+	while (tmp)
+	{
+		if (seqSearchX3(tmp, key1, key2, key3) >= 0) break;
+		tmp = tmp->next;
+		i++;
+	}
+
+	if (tmp) return i;
+	else return -1;
+}
+
+
+
+int seqSearchXY4(struct ListXY *pl, int key1, int key2, int key3, int key4)
+{
+	struct ListX *tmp = pl->list;
+	int i=0;
+
+	while (tmp)
+	{
+		if (seqSearchX4(tmp, key1, key2, key3, key4) >= 0) break;
+		tmp = tmp->next;
+		i++;
+	}
+
+	if (tmp) return i;
+	else return -1;
+}
+
+
+
+void chgVal(struct ListX *pl, int ind, int val)
+{
+	struct Item *t=pl->head;
+	int i;
+
+	for (i=0; (t) && i<ind; i++) {
+		t=t->next;
+	}
+
+	t->val = val;
+}
+
+
+
+void chgValXY(struct ListXY *pl, int ind, int val)
+{
+	pl->index[ind]->val = val;
+}
+
+
+
+void incVal(struct ListX *pl, int ind)
+{
+	struct Item *t=pl->head;
+	int i;
+
+	for (i=0; (t) && i<ind; i++) {
+		t=t->next;
+	}
+
+	t->val++;
+}
+
+
+
+void incValXY(struct ListXY *pl, int ind)
+{
+	pl->index[ind]->val++;
+}
+
+
+
+int getVal(struct ListX *pl, int ind)
+{
+	struct Item *t=pl->head;
+	int i;
+
+	for (i=0; (t) && i<ind; i++) {
+		t=t->next;
+	}
+
+	return t->val;
+}
+
+
+
+int getValXY(struct ListXY *pl, int ind)
+{
+	return pl->index[ind]->val;
+}
+
+
+
+int getKey(struct ListX *pl, int index)
+{
+	struct Item *t=pl->head;
+	int i;
+
+	for (i=0; (t) && i<index; i++) {
+		t=t->next;
+	}
+
+	return t->key;
+}
+
+
+
+void getKeys(struct ListX *pl, int *keys, int index, int count)
+{
+	struct Item *t=pl->head;
+	int i;
+
+	for (i=0; (t) && i<index; i++) {
+		t=t->next;
+	}
+
+	for (i=0; (t) && i<count; i++) {
+		keys[i] = t->key;
+		t=t->next;
+	}
+
+	keys[i] = '\0';
+}
+
+
+
+void getRowKeys(unsigned char *row, int *keys)
+{
+	int i;
+
+	for (i=0; i<DRAW_BALL; i++) {
+		keys[i] = row[i];
+	}
+
+	keys[i] = '\0';
+}
+
+
+
+struct ListX * getListXByIndex(struct ListXY *pl, int ind)
+{
+	if (ind < 0 || ind >= pl->length) return NULL;
+
+	return pl->index[ind];
+}
+
+
+
+void bubbleSortXByVal(struct ListX *pl, int inc)
+{
+	int swapped, i;
+	struct Item *ptr1;
+	struct Item *lptr = NULL;
+
+	if (pl->head == NULL) return;
+
+	do {
+		swapped = 0;
+		ptr1 = pl->head;
+
+		while (ptr1->next != lptr)
+		{
+			if (inc == 1) {
+				if (ptr1->val > ptr1->next->val) {
+					swapX(ptr1, ptr1->next);
+					swapped = 1;
+				}
+			} else if (inc == -1) {
+				if (ptr1->val < ptr1->next->val) {
+					swapX(ptr1, ptr1->next);
+					swapped = 1;
+				}
+			}
+			ptr1 = ptr1->next;
+		}
+		lptr = ptr1;
+	} while (swapped);
+}
+
+
+
+void bubbleSortYByVal(struct ListXY *pl, int inc)
+{
+	int swapped, i;
+	struct ListX *ptr1;
+	struct ListX *lptr = NULL;
+
+	if (pl->list == NULL) return;
+
+	do {
+		swapped = 0;
+		ptr1 = pl->list;
+
+		while (ptr1->next != lptr)
+		{
+			if (inc == 1) {
+				if (ptr1->val > ptr1->next->val) {
+					swapY(ptr1, ptr1->next);
+					swapped = 1;
+				}
+			} else if (inc == -1) {
+				if (ptr1->val < ptr1->next->val) {
+					swapY(ptr1, ptr1->next);
+					swapped = 1;
+				}
+			}
+			ptr1 = ptr1->next;
+		}
+		lptr = ptr1;
+	} while (swapped);
+}
+
+
+
+void bubbleSortXByKey(struct ListX *pl)
+{
+	int swapped, i;
+	struct Item *ptr1;
+	struct Item *lptr = NULL;
+
+	if (pl->head == NULL) return;
+
+	do {
+		swapped = 0;
+		ptr1 = pl->head;
+
+		while (ptr1->next != lptr)
+		{
+			if (ptr1->key > ptr1->next->key) {
+				swapX(ptr1, ptr1->next);
+				swapped = 1;
+			}
+			ptr1 = ptr1->next;
+		}
+		lptr = ptr1;
+	} while (swapped);
+}
+
+
+
+void swapX(struct Item *a, struct Item *b)
+{
+	int temp;
+
+	temp = a->key;
+	a->key = b->key;
+	b->key = temp;
+
+	temp = a->val;
+	a->val = b->val;
+	b->val = temp;
+}
+
+
+
+void swapY(struct ListX *a, struct ListX *b)
+{
+	struct Item *head;
+	char *date;
+	char *label;
+	int val;
+
+	val = a->val;
+	a->val = b->val;
+	b->val = val;
+
+	date = a->date;
+	a->date = b->date;
+	b->date = date;
+
+	label = a->label;
+	a->label = b->label;
+	b->label = label;
+
+	head = b->head;
+	b->head = a->head;
+	a->head = head;
+}
+
+
+
+void printListXByKey(struct ListX *pl, int printTo, FILE *fp)
+{
+	struct Item *t=pl->head;
+
+	while (t) {
+		if (printTo == 0) { // print to screen and output file
+			printf("%2d ", t->key);
+			fprintf(fp, "%2d ", t->key);
+		} else if (printTo == 1) { // print to screen only
+			printf("%2d ", t->key);
+		} else if (printTo == 2) { // print to output file only
+			fprintf(fp, "%2d ", t->key);
+		}
+		t=t->next;
+	}
+}
+
+
+
+void printRowByKey(unsigned char *row, int printTo, FILE *fp)
+{
+	int i;
+
+	for (i=0; i<DRAW_BALL; i++) {
+		if (printTo == 0) { // print to screen and output file
+			if (printScreen) printf("%2d ", row[i]);
+			fprintf(fp, "%2d ", row[i]);
+		} else if (printTo == 1) { // print to screen only
+			if (printScreen) printf("%2d ", row[i]);
+		} else if (printTo == 2) { // print to output file only
+			fprintf(fp, "%2d ", row[i]);
+		}
+	}
+}
+
+
+
+void printListXYByKey(struct ListXY *pl, FILE *fp)
+{
+	struct ListX *nl = pl->list;
+	struct Item *pt = nl->head;
+	int i;
+
+	if (printScreen) printf("     Numbers\n\n");
+
+	if (fp != NULL) fprintf(fp, "     Numbers\n\n");
+
+	for (i=1; (nl); i++) 
+	{
+		if (printScreen) printf("%2d - ", i);
+
+		if (fp != NULL) fprintf(fp, "%2d - ", i);
+
+		while (pt) 
+		{
+			if (printScreen) printf("%2d ", pt->key);
+			if (fp != NULL) fprintf(fp, "%2d ", pt->key);
+			pt = pt->next;
+		}
+
+		if (nl->label) {
+			if (printScreen) printf("  %s", nl->label);
+			if (fp != NULL) fprintf(fp, "  %s", nl->label);
+		}
+
+		nl = nl->next;
+		if (nl != NULL) pt = nl->head;
+		if (printScreen) printf("\n");
+		if (fp != NULL) fprintf(fp, "\n");
+	}
+}
+
+
+
+void printListXYWithBonusByKey(struct ListXY *pl1, struct ListXY *pl2, FILE *fp)
+{
+	struct ListX *nl1 = pl1->list;
+	struct ListX *nl2 = pl2->list;
+	struct Item *pt1 = nl1->head;
+	struct Item *pt2 = nl2->head;
+	int i;
+
+	if (printScreen) printf("%s\n\n", game.couponHeader);
+	if (fp != NULL) fprintf(fp, "%s\n\n", game.couponHeader);
+
+	for (i=1; (nl1) && (nl2); i++) 
+	{
+		if (printScreen) printf("%2d - ", i);
+		if (fp != NULL) fprintf(fp, "%2d - ", i);
+
+		while (pt1) {
+			if (printScreen) printf("%2d ", pt1->key);
+			if (fp != NULL) fprintf(fp, "%2d ", pt1->key);
+			pt1 = pt1->next;
+		}
+
+		if (printScreen) printf("  %2d ", pt2->key);
+		if (fp != NULL) fprintf(fp, "  %2d ", pt2->key);
+
+		if (nl1->label) {
+			if (printScreen) printf("     %s", nl1->label);
+			if (fp != NULL) fprintf(fp, "     %s", nl1->label);
+		}
+
+		nl1 = nl1->next;
+		nl2 = nl2->next;
+
+		if (nl1 != NULL && nl2 != NULL) {
+			pt1 = nl1->head;
+			pt2 = nl2->head;
+		}
+
+		if (printScreen) printf("\n");
+		if (fp != NULL) fprintf(fp, "\n");
+	}
+}
+
+
+
+void printBallStats(struct ListX *ballStats, FILE *fp)
+{
+	struct Item *t = ballStats->head;
+	int i = 0;
+
+#ifdef __MSDOS__
+	int col = 10;
+#else
+	int col = 15;
+#endif
+
+	while (t) {
+		if (printScreen) printf("%2d:%3d", t->key, t->val);
+		if (fp != NULL) fprintf(fp, "%2d:%3d", t->key, t->val);
+
+		if ((i+1) % col == 0) {
+			if (printScreen) printf("\n");
+			if (fp != NULL) fprintf(fp, "\n");
+		} else {
+			if (printScreen) printf("  ");
+			if (fp != NULL) fprintf(fp, "  ");
+		}
+
+		t=t->next;
+		i++;
+	}
+}
+
+
+
+void printLuckyBalls(struct ListXY *pl, FILE *fp)
+{
+	struct ListX *nl = pl->list;
+	struct Item *pt;
+	int i = 0;
+	int len, col;
+
+	if (nl == NULL) {
+		if (printScreen) printf("No numbers drawn together in 2 or more draws\n");
+		if (fp != NULL) fprintf(fp, "No numbers drawn together in 2 or more draws\n");
+		return;
+	}
+
+	pt = nl->head;
+	len = length(nl);
+
+#ifdef __MSDOS__
+	col = 6-len;
+#else
+	col = 8-len;
+#endif
+
+	while (nl)
+	{
+		while (pt) {
+			if (printScreen) printf("%2d ", pt->key);
+			if (fp != NULL) fprintf(fp, "%2d ", pt->key);
+			pt = pt->next;
+		}
+
+		if (printScreen) printf(": %2d times", nl->val);
+		if (fp != NULL) fprintf(fp, ": %2d times", nl->val);
+
+		if ((i+1) % col == 0) {
+			if (printScreen) printf("\n");
+			if (fp != NULL) fprintf(fp, "\n");
+		} else {
+			if (printScreen) printf("    ");
+			if (fp != NULL) fprintf(fp, "    ");
+		}
+
+		i++;
+		nl = nl->next;
+		if (nl != NULL) pt = nl->head;
+	}
+	if (printScreen) printf("\n");
+}
+
+
+
+int numberOfTerm(int sum)
+{
+	int n;
+
+	for (n=0; sum>0; n++) {
+		sum = sum - (n+1);
+	}
+
+	return n;
+}
+
+
+
+void seedRng(struct Rng *pr, int type, unsigned long seed)
+{
+	unsigned int x = (unsigned int) seed, z;
+	int i;
+
+	pr->type = type;
+
+	if (type == RNG_LIBC) srand((unsigned) seed);
+
+	for (i=0; i<4; i++) {
+		x += 0x9E3779B9U;
+		z = x;
+		z = (z ^ (z >> 16)) * 0x85EBCA6BU;
+		z = (z ^ (z >> 13)) * 0xC2B2AE35U;
+		pr->s[i] = z ^ (z >> 16);
+	}
+
+	if (!(pr->s[0] | pr->s[1] | pr->s[2] | pr->s[3])) pr->s[0] = 1;
+}
+
+
+
+unsigned int nextRng(struct Rng *pr)
+{
+	unsigned int *s = pr->s;
+	unsigned int result, t;
+
+	if (pr->type == RNG_LIBC) return (unsigned int) rand();
+
+	t = s[1] * 5;
+	result = ((t << 7) | (t >> 25)) * 9;
+	t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = (s[3] << 11) | (s[3] >> 21);
+
+	return result;
+}
+
+
+
+int randRng(struct Rng *pr, int n)
+{
+	unsigned int x, limit;
+
+	if (pr->type == RNG_LIBC) return rand() % n;
+
+	limit = 0xFFFFFFFFU - 0xFFFFFFFFU % n;
+
+	do {
+		x = nextRng(pr);
+	} while (x >= limit);
+
+	return (int) (x % n);
+}
+
+
+
+void jumpRng(struct Rng *pr)
+{
+	static const unsigned int jump[4] = { 0x8764000bU, 0xf542d2d3U, 0x6fa035c3U, 0x77f2db5bU };
+	unsigned int s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	int i, b;
+
+	if (pr->type == RNG_LIBC) return;
+
+	for (i=0; i<4; i++) {
+		for (b=0; b<32; b++) {
+			if (jump[i] & (1U << b)) {
+				s0 ^= pr->s[0];
+				s1 ^= pr->s[1];
+				s2 ^= pr->s[2];
+				s3 ^= pr->s[3];
+			}
+			nextRng(pr);
+		}
+	}
+
+	pr->s[0] = s0;
+	pr->s[1] = s1;
+	pr->s[2] = s2;
+	pr->s[3] = s3;
+}
+
+
+
+int gaussIndex(int ballCount, struct Rng *rng)
+{
+	int node=0, leftnode=0, level;
+	unsigned long long x;
+	int col;
+
+	if (rng->type != RNG_LIBC && ballCount >= 1 && ballCount <= MAX_TOTAL_BALL)
+	{
+		x = (unsigned long long) nextRng(rng) * ballCount;
+		col = (int) (x >> 32);
+
+		if ((unsigned int) x < gaussTable[ballCount].prob[col]) return col + 1;
+		else return gaussTable[ballCount].alias[col] + 1;
+	}
+
+	for (level=1; level<ballCount;)
+	{
+		if (randRng(rng, 100) < 49 + randRng(rng, 2))
+			node = node + level;
+		else
+			node = node + level + 1;
+
+		leftnode = leftnode + level;
+		level++;
+	}
+
+	return node - (leftnode-1);
+}
+
+
+
+void initGauss()
+{
+	int n;
+
+	for (n=1; n<=MAX_TOTAL_BALL; n++) {
+		buildGaussTable(&gaussTable[n], n);
+	}
+}
+
+
+
+void buildGaussTable(struct GaussTable *pt, int ballCount)
+{
+	double p[MAX_TOTAL_BALL];
+	int small[MAX_TOTAL_BALL], large[MAX_TOTAL_BALL];
+	int ns = 0, nl = 0;
+	int k, m = ballCount - 1;
+	int s, l;
+
+	/* binomial(m, GAUSS_RIGHT) probabilities, scaled by the ball count */
+	p[0] = pow(1 - GAUSS_RIGHT, m);
+
+	for (k=0; k<m; k++) {
+		p[k+1] = p[k] * (m-k) / (k+1) * GAUSS_RIGHT / (1 - GAUSS_RIGHT);
+	}
+
+	for (k=0; k<ballCount; k++) {
+		pt->weight[k] = p[k];
+		p[k] *= ballCount;
+		if (p[k] < 1) small[ns++] = k;
+		else large[nl++] = k;
+	}
+
+	while (ns && nl)
+	{
+		s = small[--ns];
+		l = large[--nl];
+
+		pt->prob[s] = (unsigned int) (p[s] * 4294967296.0);
+		pt->alias[s] = l;
+
+		p[l] = p[l] + p[s] - 1;
+
+		if (p[l] < 1) small[ns++] = l;
+		else large[nl++] = l;
+	}
+
+	while (nl) {
+		l = large[--nl];
+		pt->prob[l] = 0xFFFFFFFFU;
+		pt->alias[l] = l;
+	}
+
+	while (ns) {
+		s = small[--ns];
+		pt->prob[s] = 0xFFFFFFFFU;
+		pt->alias[s] = s;
+	}
+}
+
+
+
+int testGauss(FILE *fp)
+{
+	int counts[4] = {90, 69, 60, 26};
+	double pmf[MAX_TOTAL_BALL], binom, error, chi, expected, a, w, limit;
+	long alias[MAX_TOTAL_BALL], walk[MAX_TOTAL_BALL];
+	long binA[MAX_TOTAL_BALL], binW[MAX_TOTAL_BALL];
+	struct GaussTable *pt;
+	struct Rng aliasRng, walkRng;
+	int c, i, k, n, m, df, bins, passed = 1;
+	long samples;
+
+	initGauss();
+
+	for (c=0; c<4; c++) 
+	{
+		n = counts[c];
+		m = n - 1;
+		pt = &gaussTable[n];
+
+		/* distribution of the alias table: the column is kept with prob/2^32, its alias is taken otherwise */
+		for (k=0; k<n; k++) {
+			pmf[k] = 0;
+		}
+
+		for (k=0; k<n; k++) {
+			pmf[k] += pt->prob[k] / 4294967296.0 / n;
+			pmf[pt->alias[k]] += (1 - pt->prob[k] / 4294967296.0) / n;
+		}
+
+		for (k=0, error=0; k<n; k++) {
+			binom = exp(lgamma(m+1) - lgamma(k+1) - lgamma(m-k+1) + k*log(GAUSS_RIGHT) + (m-k)*log(1-GAUSS_RIGHT));
+			if (fabs(pmf[k] - binom) > error) error = fabs(pmf[k] - binom);
+		}
+
+		/* the same number of indexes from both samplers */
+		seedRng(&aliasRng, RNG_XOSHIRO, 1);
+		seedRng(&walkRng, RNG_LIBC, 1);
+
+		for (k=0; k<n; k++) {
+			alias[k] = walk[k] = 0;
+		}
+
+		for (samples=0; samples<SELF_TEST_SAMPLES; samples++) {
+			alias[gaussIndex(n, &aliasRng)-1]++;
+			walk[gaussIndex(n, &walkRng)-1]++;
+		}
+
+		/* chi-square of homogeneity, the indexes are pooled into bins of at least 10 expected samples 
+		   (a thin last bin is merged into the previous one) */
+		for (k=0, bins=0, expected=0; k<n; k++) 
+		{
+			if (expected == 0) binA[bins] = binW[bins] = 0;
+
+			expected += pmf[k] * 2 * SELF_TEST_SAMPLES;
+			binA[bins] += alias[k];
+			binW[bins] += walk[k];
+
+			if (expected >= 10) {
+				bins++;
+				expected = 0;
+			}
+		}
+
+		if (expected > 0 && bins > 0) {
+			binA[bins-1] += binA[bins];
+			binW[bins-1] += binW[bins];
+		} else if (expected > 0) {
+			bins++;
+		}
+
+		for (i=0, chi=0; i<bins; i++) {
+			a = binA[i];
+			w = binW[i];
+			if (a + w > 0) chi += (a - w) * (a - w) / (a + w);
+		}
+
+		df = bins - 1;
+		limit = chiSquareLimit(df);
+
+		fprintf(fp, "gaussIndex %2d balls: alias pmf error %.1e, chi-square alias/walk %.1f (%d df, limit %.1f) %s\n", 
+			n, error, chi, df, limit, (error < 1e-9 && chi < limit) ? "ok" : "FAILED");
+
+		if (error >= 1e-9 || chi >= limit) passed = 0;
+	}
+
+	fprintf(fp, "\nself-test %s\n", passed ? "passed" : "FAILED");
+
+	return passed;
+}
+
+
+
+double chiSquareLimit(int df)
+{
+	double z = 3.0902;	/* 0.999 quantile of the normal distribution */
+	double v = 2.0 / (9.0 * df);
+
+	return df * pow(1 - v + z * sqrt(v), 3);
+}
+
+
+
+int findComb(struct ListX *drawnBalls, int comb)
+{
+	int keys[MAX_TOTAL_BALL+1];
+	int count;
+
+	if (comb < 2 || comb > DRAW_BALL) return 0;
+
+	count = length(drawnBalls);
+	if (count > DRAW_BALL) count = DRAW_BALL;
+
+	getKeys(drawnBalls, keys, 0, count);
+	sortKeys(keys, count);
+
+	return testCombFilter(combFilter, keys, count, comb);
+}
+
+
+
+void clearMask(struct BallMask *mask)
+{
+	int i;
+
+	for (i=0; i<MASK_WORDS; i++) {
+		mask->bits[i] = 0;
+	}
+}
+
+
+
+void setMaskBall(struct BallMask *mask, int key)
+{
+	mask->bits[(key-1) / MASK_WORD_BITS] |= 1UL << ((key-1) % MASK_WORD_BITS);
+}
+
+
+
+int testMaskBall(struct BallMask *mask, int key)
+{
+	return (mask->bits[(key-1) / MASK_WORD_BITS] >> ((key-1) % MASK_WORD_BITS)) & 1;
+}
+
+
+
+void getRowMask(unsigned char *row, struct BallMask *mask)
+{
+	int i;
+
+	clearMask(mask);
+
+	for (i=0; i<DRAW_BALL; i++) {
+		setMaskBall(mask, row[i]);
+	}
+}
+
+
+
+void getListMask(struct ListX *pl, int count, struct BallMask *mask)
+{
+	struct Item *t=pl->head;
+	int i;
+
+	clearMask(mask);
+
+	for (i=0; (t) && i<count; i++) {
+		setMaskBall(mask, t->key);
+		t=t->next;
+	}
+}
+
+
+
+int popCount(unsigned long word)
+{
+#if defined(__GNUC__)
+	return __builtin_popcountl(word);
+#else
+	int count = 0;
+
+	while (word) {
+		word &= word - 1;
+		count++;
+	}
+
+	return count;
+#endif
+}
+
+
+
+int countCommon(struct BallMask *mask1, struct BallMask *mask2)
+{
+	int i, count = 0;
+
+	for (i=0; i<MASK_WORDS; i++) {
+		count += popCount(mask1->bits[i] & mask2->bits[i]);
+	}
+
+	return count;
+}
+
+
+
+int nextCombIndex(int *ind, int comb, int count)
+{
+	int i, j;
+
+	for (i=comb-1; i>=0 && ind[i] == count-comb+i; i--);
+
+	if (i < 0) return 0;
+
+	ind[i]++;
+
+	for (j=i+1; j<comb; j++) {
+		ind[j] = ind[j-1] + 1;
+	}
+
+	return 1;
+}
+
+
+
+int searchCombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls, int comb)
+{
+	int keys[MAX_DRAW_BALL+1];
+	int count;
+
+	if (lengthY(prvDrawnsList) == 0) return 0;
+
+	count = length(drawnBalls);
+	if (count > DRAW_BALL) count = DRAW_BALL;
+
+	getKeys(drawnBalls, keys, 0, count);
+	sortKeys(keys, count);
+
+	/* a previous draw has "comb" common balls if one of the "comb" combinations of the new draw is in it */
+	return testCombFilter(getListFilter(prvDrawnsList), keys, count, comb);
+}
+
+
+
+int searchCombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, int comb, char *buf)
+{
+	struct BallMask mask1, mask2;
+	int common[MAX_DRAW_BALL];
+	int ind[MAX_DRAW_BALL];
+	int keys[MAX_DRAW_BALL+1];
+	int i, count;
+	int found = 0;
+	char fStr[20];
+
+	if (buf) buf[0] = '\0';
+
+	getRowMask(aPrvDrawn, &mask1);
+	getRowMask(drawnBalls, &mask2);
+
+	if (countCommon(&mask1, &mask2) < comb) return 0;
+
+	if (buf == NULL) return 1;
+
+	/* common balls, in the order of the drawnBalls */
+	for (i=0, count=0; i<DRAW_BALL; i++) {
+		if (testMaskBall(&mask1, drawnBalls[i])) common[count++] = drawnBalls[i];
+	}
+
+	/* every "comb" combination of the common balls is a matching combination */
+	for (i=0; i<comb; i++) ind[i] = i;
+
+	do {
+		for (i=0; i<comb; i++) keys[i] = common[ind[i]];
+		keys[comb] = '\0';
+
+		if (buf) {
+			if (found) strcat(buf, ", ");
+			strcat(buf, "(");
+			for (i=0; i<comb; i++) {
+				sprintf(fStr, (i == 0) ? "%2d" : ",%2d", keys[i]);
+				strcat(buf, fStr);
+			}
+			strcat(buf, ")");
+		}
+
+		found = 1;
+	} while (nextCombIndex(ind, comb, count));
+
+	return found;
+}
+
+
+
+int search6CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+{
+	return searchCombXY(prvDrawnsList, drawnBalls, 6);
+}
+
+
+
+int search6CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls)
+{
+	return searchCombX(aPrvDrawn, drawnBalls, 6, NULL);
+}
+
+
+
+int search5CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+{
+	return searchCombXY(prvDrawnsList, drawnBalls, 5);
+}
+
+
+
+int search5CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf)
+{
+	return searchCombX(aPrvDrawn, drawnBalls, 5, buf);
+}
+
+
+
+int search4CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+{
+	return searchCombXY(prvDrawnsList, drawnBalls, 4);
+}
+
+
+
+int search4CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf)
+{
+	return searchCombX(aPrvDrawn, drawnBalls, 4, buf);
+}
+
+
+
+int search3CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+{
+	return searchCombXY(prvDrawnsList, drawnBalls, 3);
+}
+
+
+
+int search3CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf)
+{
+	return searchCombX(aPrvDrawn, drawnBalls, 3, buf);
+}
+
+
+
+int search2CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+{
+	return searchCombXY(prvDrawnsList, drawnBalls, 2);
+}
+
+
+
+int search2CombX(unsigned char *aPrvDrawn, unsigned char *drawnBalls, char *buf)
+{
+	return searchCombX(aPrvDrawn, drawnBalls, 2, buf);
+}
+
+
+
+int search1BallXY(struct ListXY *couponList, struct ListX *drawnBalls, int drawBall)
+{
+	int keys[MAX_DRAW_BALL+1];
+	int count;
+
+	if (lengthY(couponList) == 0) return 0;
+
+	count = length(drawnBalls);
+	if (count > drawBall) count = drawBall;
+
+	getKeys(drawnBalls, keys, 0, count);
+	sortKeys(keys, count);
+
+	return testCombFilter(getListFilter(couponList), keys, count, 1);
+}
+
+
+
+void init()
+{
+	int i, err, cached;
+	long keyCount;
+	char realPath[PATH_MAX];
+	char *ext;
+	cwd = (char *) malloc(sizeof(char)*PATH_MAX);
+	fileStats = (char *) malloc(sizeof(char)*PATH_MAX);
+	outputFile = (char *) malloc(sizeof(char)*PATH_MAX);
+	fileCache = (char *) malloc(sizeof(char)*(PATH_MAX+sizeof(CACHE_EXT)));
+
+	fileStats[0] = '\0';
+	outputFile[0] = '\0';
+
+#if defined(__linux__) || defined(__unix__) || defined(__APPLE__) || defined(SOLARIS) || defined(WIN32)
+	err = get_app_path(realPath, PATH_MAX);
+	if (err) puts("App path lookup failed!");
+	else {
+		cwd = dirname(realPath);
+
+		strcat(fileStats, cwd);
+		strcat(fileStats, PATH_SEPARATOR);
+		strcat(outputFile, cwd);
+		strcat(outputFile, PATH_SEPARATOR);
+	}
+#endif
+
+	strcat(fileStats, game.fileStats);
+	strcat(outputFile, OUTPUTFILE);
+
+	/* the history cache is next to the statistics file, in place of its extension */
+	strcpy(fileCache, fileStats);
+	if ((ext = strrchr(fileCache, '.')) != NULL && strchr(ext, PATH_SEPARATOR[0]) == NULL) *ext = '\0';
+	strcat(fileCache, CACHE_EXT);
+
+	initBinom();
+	initGauss();
+
+	if (printScreen) printf("Initializing... Please wait.\n");
+
+	drawHistory = createDrawHistory(drawHistory);
+
+	cached = loadDrawHistory(drawHistory, fileStats, useCache ? fileCache : NULL);
+
+	/* the commands and the batch have nothing to work on without the statistics file */
+	if (cached < 0 && (command || batchCount)) exit(1);
+
+	drawArena = createArena(drawArena);
+
+	/* double and triple combinations are counted at load, quartet combinations on first use */
+	luckyIndex = createLuckyIndex(luckyIndex);
+	getLuckyCounts(luckyIndex, 2);
+	getLuckyCounts(luckyIndex, 3);
+
+	combFilter = createCombFilter(combFilter, FILTER_BITS_COMB);
+
+	/* Bloom filters sized from the loaded history, C(DRAW_BALL, comb) combinations per draw 
+	   (not in front of a bitset smaller than the Bloom filter, it is a fast exact filter already) */
+	for (i=2; useBloom && i<=DRAW_BALL; i++) 
+	{
+		keyCount = drawHistory->count * choose(DRAW_BALL, i);
+
+		if (i <= FILTER_BITS_COMB && choose(TOTAL_BALL, i) <= keyCount * BLOOM_BITS_PER_KEY) continue;
+
+		combFilter->bloom[i] = createBloomFilter(combFilter->bloom[i], keyCount);
+	}
+
+	for (i=0; i<drawHistory->count; i++) {
+		addCombFilter(combFilter, drawHistory->balls[i]);
+	}
+
+	winningBallStats = createListX(winningBallStats, NULL, NULL, 0);
+	bonusBallStats = createListX(bonusBallStats, NULL, NULL, 0);
+	getDrawnBallsStats(drawHistory, winningBallStats, bonusBallStats);
+
+	/* the matched combination counts of a cached history are in the cache, otherwise the cache is written with them */
+	if (!cached) {
+		calcMatchCombCount();
+		if (useCache && drawHistory->count > 0) writeHistoryCache(drawHistory, fileStats, fileCache);
+	}
+
+	if (printScreen) clearScreen();
+}
+
+
+
+struct ListXY * getLuckyBalls(struct ListXY *luckyBalls, int comb)
+{
+	struct LuckyWork works[MAX_THREADS];
+	struct LuckyEntry *entries = NULL;
+	struct ListX *lb = NULL;
+	int keys[5];
+	int i, t, count = 0;
+
+	if (comb != 2 && comb != 3 && comb != 4) return luckyBalls;
+
+	/* every thread collects the lucky numbers in its ranks, the partial tables are merged and sorted once */
+	splitLuckyWorks(works, comb, getLuckyCounts(luckyIndex, comb));
+	runWorkers(luckyEntryWorker, works, sizeof(struct LuckyWork), threadCount);
+
+	for (t=0; t<threadCount; t++) {
+		count += works[t].count;
+	}
+
+	entries = (struct LuckyEntry *) malloc(sizeof(struct LuckyEntry)*(count+1));
+
+	for (t=0, count=0; t<threadCount; t++) 
+	{
+		for (i=0; i<works[t].count; i++) {
+			entries[count++] = works[t].entries[i];
+		}
+
+		free(works[t].entries);
+	}
+
+	/* the order in which the combinations are found when the draws are compared with each other */
+	qsort(entries, count, sizeof(struct LuckyEntry), compareLucky);
+
+	for (i=0; i<count; i++) 
+	{
+		unpackComb(entries[i].key, comb, keys);
+		lb = createListX(lb, NULL, NULL, entries[i].cc.count);
+		appendItems(lb, keys);
+		appendList(luckyBalls, lb);
+	}
+
+	free(entries);
+
+	return luckyBalls;
+}
+
+
+
+struct LuckyIndex *createLuckyIndex(struct LuckyIndex *pi)
+{
+	int i;
+
+	pi = (struct LuckyIndex *) malloc(sizeof(struct LuckyIndex));
+
+	for (i=0; i<5; i++) {
+		pi->counts[i] = NULL;
+	}
+
+	return pi;
+}
+
+
+
+void *luckyRankWorker(void *arg)
+{
+	struct LuckyWork *work = (struct LuckyWork *) arg;
+	int keys[MAX_DRAW_BALL+1];
+	long per = choose(DRAW_BALL, work->comb);
+	int i;
+
+	for (i=work->firstRow; i<work->lastRow; i++) 
+	{
+		getRowKeys(drawHistory->balls[i], keys);
+		rankCombs(keys, DRAW_BALL, work->comb, &work->ranks[i*per]);
+	}
+
+	return NULL;
+}
+
+
+
+void *luckyCountWorker(void *arg)
+{
+	struct LuckyWork *work = (struct LuckyWork *) arg;
+	long per = choose(DRAW_BALL, work->comb);
+	long *ranks = work->ranks;
+	long j;
+	int i;
+
+	for (i=0; i<drawHistory->count; i++, ranks += per) 
+	{
+		for (j=0; j<per; j++) {
+			if (ranks[j] >= work->first && ranks[j] < work->last) countComb(&work->counts[ranks[j]], i);
+		}
+	}
+
+	return NULL;
+}
+
+
+
+void *luckyEntryWorker(void *arg)
+{
+	struct LuckyWork *work = (struct LuckyWork *) arg;
+	int keys[5];
+	long rank;
+
+	work->count = 0;
+
+	for (rank=work->first; rank<work->last; rank++) {
+		if (work->counts[rank].count >= 2) work->count++;
+	}
+
+	work->entries = (struct LuckyEntry *) malloc(sizeof(struct LuckyEntry)*(work->count+1));
+	work->count = 0;
+
+	for (rank=work->first; rank<work->last; rank++) 
+	{
+		if (work->counts[rank].count < 2) continue;
+
+		unrankComb(rank, work->comb, keys);
+		work->entries[work->count].key = packComb(keys, work->comb);
+		work->entries[work->count].cc = work->counts[rank];
+		work->count++;
+	}
+
+	return NULL;
+}
+
+
+
+void splitLuckyWorks(struct LuckyWork *works, int comb, struct CombCount *counts)
+{
+	long total = choose(TOTAL_BALL, comb);
+	int t;
+
+	for (t=0; t<threadCount; t++) 
+	{
+		works[t].comb = comb;
+		works[t].first = total*t/threadCount;
+		works[t].last = total*(t+1)/threadCount;
+		works[t].firstRow = (int) ((long) drawHistory->count*t/threadCount);
+		works[t].lastRow = (int) ((long) drawHistory->count*(t+1)/threadCount);
+		works[t].ranks = NULL;
+		works[t].counts = counts;
+		works[t].entries = NULL;
+		works[t].count = 0;
+	}
+}
+
+
+
+struct CombCount *getLuckyCounts(struct LuckyIndex *pi, int comb)
+{
+	struct LuckyWork works[MAX_THREADS];
+	long *ranks;
+	int t;
+
+	if (pi->counts[comb] == NULL) 
+	{
+		pi->counts[comb] = (struct CombCount *) calloc(choose(TOTAL_BALL, comb), sizeof(struct CombCount));
+		ranks = (long *) malloc(sizeof(long)*(drawHistory->count*choose(DRAW_BALL, comb)+1));
+
+		/* every thread ranks the combinations of its draws once, then counts the combinations in its ranks */
+		splitLuckyWorks(works, comb, pi->counts[comb]);
+
+		for (t=0; t<threadCount; t++) {
+			works[t].ranks = ranks;
+		}
+
+		runWorkers(luckyRankWorker, works, sizeof(struct LuckyWork), threadCount);
+		runWorkers(luckyCountWorker, works, sizeof(struct LuckyWork), threadCount);
+
+		free(ranks);
+	}
+
+	return pi->counts[comb];
+}
+
+
+
+void initBinom()
+{
+	int n, k;
+
+	for (n=0; n<=TOTAL_BALL; n++) 
+	{
+		binomTable[n][0] = 1;
+
+		for (k=1; k<=DRAW_BALL; k++) {
+			binomTable[n][k] = (n == 0) ? 0 : binomTable[n-1][k-1] + binomTable[n-1][k];
+		}
+	}
+}
+
+
+
+long choose(int n, int k)
+{
+	if (n < 0 || k < 0 || k > DRAW_BALL || n > TOTAL_BALL) return 0;
+
+	return binomTable[n][k];
+}
+
+
+
+long rankComb(int *keys, int comb)
+{
+	long rank = 0;
+	int i;
+
+	for (i=0; i<comb; i++) {
+		rank += binomTable[keys[i]-1][i+1];
+	}
+
+	return rank;
+}
+
+
+
+/* 
+ * Combination kernels. COMB_KERNEL(N, K) defines rankCombsNK, the ranks of the K combinations of N keys: K nested 
+ * loops, loop d takes the key d of the combination and adds its binomial to the rank of the prefix (r[d+1]). 
+ * The depth and the bounds are constants, so the loops of a kernel are unrolled by the compiler.
+ */
+#define COMB_LOOP(N, K, d) \
+	for (i[d+1] = i[d]+1; i[d+1] <= (N)-(K)+(d); i[d+1]++) { \
+		r[d+1] = r[d] + binomTable[keys[i[d+1]]-1][(d)+1];
+
+#define COMB_LOOPS_1(N) COMB_LOOP(N, 1, 0) ranks[n++] = r[1]; }
+#define COMB_LOOPS_2(N) COMB_LOOP(N, 2, 0) COMB_LOOP(N, 2, 1) ranks[n++] = r[2]; }}
+#define COMB_LOOPS_3(N) COMB_LOOP(N, 3, 0) COMB_LOOP(N, 3, 1) COMB_LOOP(N, 3, 2) ranks[n++] = r[3]; }}}
+#define COMB_LOOPS_4(N) COMB_LOOP(N, 4, 0) COMB_LOOP(N, 4, 1) COMB_LOOP(N, 4, 2) COMB_LOOP(N, 4, 3) \
+	ranks[n++] = r[4]; }}}}
+#define COMB_LOOPS_5(N) COMB_LOOP(N, 5, 0) COMB_LOOP(N, 5, 1) COMB_LOOP(N, 5, 2) COMB_LOOP(N, 5, 3) \
+	COMB_LOOP(N, 5, 4) ranks[n++] = r[5]; }}}}}
+#define COMB_LOOPS_6(N) COMB_LOOP(N, 6, 0) COMB_LOOP(N, 6, 1) COMB_LOOP(N, 6, 2) COMB_LOOP(N, 6, 3) \
+	COMB_LOOP(N, 6, 4) COMB_LOOP(N, 6, 5) ranks[n++] = r[6]; }}}}}}
+
+#define COMB_KERNEL(N, K) \
+int rankCombs##N##K(int *keys, long *ranks) \
+{ \
+	int i[K+1]; \
+	long r[K+1]; \
+	int n = 0; \
+	\
+	i[0] = -1; \
+	r[0] = 0; \
+	COMB_LOOPS_##K(N) \
+	\
+	return n; \
+}
+
+COMB_KERNEL(1, 1)
+COMB_KERNEL(2, 1) COMB_KERNEL(2, 2)
+COMB_KERNEL(3, 1) COMB_KERNEL(3, 2) COMB_KERNEL(3, 3)
+COMB_KERNEL(4, 1) COMB_KERNEL(4, 2) COMB_KERNEL(4, 3) COMB_KERNEL(4, 4)
+COMB_KERNEL(5, 1) COMB_KERNEL(5, 2) COMB_KERNEL(5, 3) COMB_KERNEL(5, 4) COMB_KERNEL(5, 5)
+COMB_KERNEL(6, 1) COMB_KERNEL(6, 2) COMB_KERNEL(6, 3) COMB_KERNEL(6, 4) COMB_KERNEL(6, 5) COMB_KERNEL(6, 6)
+
+/* kernels by (count, comb), a row for every draw size up to MAX_DRAW_BALL */
+int (*combKernels[MAX_DRAW_BALL+1][MAX_DRAW_BALL+1])(int *keys, long *ranks) = {
+	{NULL},
+	{NULL, rankCombs11},
+	{NULL, rankCombs21, rankCombs22},
+	{NULL, rankCombs31, rankCombs32, rankCombs33},
+	{NULL, rankCombs41, rankCombs42, rankCombs43, rankCombs44},
+	{NULL, rankCombs51, rankCombs52, rankCombs53, rankCombs54, rankCombs55},
+	{NULL, rankCombs61, rankCombs62, rankCombs63, rankCombs64, rankCombs65, rankCombs66}
+};
+
+
+
+int rankCombs(int *keys, int count, int comb, long *ranks)
+{
+	if (comb < 1 || comb > count || count > MAX_DRAW_BALL) return 0;
+
+	return combKernels[count][comb](keys, ranks);
+}
+
+
+
+void unrankComb(long rank, int comb, int *keys)
+{
+	int i, n = TOTAL_BALL;
+
+	for (i=comb; i>0; i--) 
+	{
+		while (binomTable[n-1][i] > rank) n--;
+
+		keys[i-1] = n;
+		rank -= binomTable[n-1][i];
+		n--;
+	}
+
+	keys[comb] = '\0';
+}
+
+
+
+unsigned long packComb(int *keys, int comb)
+{
+	unsigned long key = 0;
+	int i;
+
+	for (i=0; i<comb; i++) {
+		key = (key << 8) | (unsigned long) keys[i];
+	}
+
+	return key;
+}
+
+
+
+void unpackComb(unsigned long key, int comb, int *keys)
+{
+	int i;
+
+	for (i=comb-1; i>=0; i--) {
+		keys[i] = (int) (key & 0xFF);
+		key >>= 8;
+	}
+
+	keys[comb] = '\0';
+}
+
+
+
+int combSlot(unsigned long *keys, int size, unsigned long key)
+{
+	unsigned long h;
+
+	for (h = (key * 2654435761UL) >> 4; keys[h & (size-1)] != 0; h++) {
+		if (keys[h & (size-1)] == key) break;
+	}
+
+	return (int) (h & (size-1));
+}
+
+
+
+void countComb(struct CombCount *pc, int drawIndex)
+{
+	if (pc->count == 0) pc->first = drawIndex;
+	else if (pc->count == 1) pc->second = drawIndex;
+
+	pc->count++;
+}
+
+
+
+int compareLucky(const void *a, const void *b)
+{
+	const struct LuckyEntry *e1 = (const struct LuckyEntry *) a;
+	const struct LuckyEntry *e2 = (const struct LuckyEntry *) b;
+
+	if (e1->cc.first != e2->cc.first) return (e1->cc.first < e2->cc.first) ? -1 : 1;
+	if (e1->cc.second != e2->cc.second) return (e1->cc.second < e2->cc.second) ? -1 : 1;
+	if (e1->key != e2->key) return (e1->key < e2->key) ? -1 : 1;
+
+	return 0;
+}
+
+
+
+void calcMatchCombCount()
+{
+	struct MatchCombWork works[MAX_THREADS];
+	int bounds[MAX_THREADS+1];
+	int t;
+
+	splitTriangle(drawHistory->count, threadCount, bounds);
+
+	for (t=0; t<threadCount; t++) {
+		works[t].first = bounds[t];
+		works[t].last = bounds[t+1];
+	}
+
+	runWorkers(matchCombWorker, works, sizeof(struct MatchCombWork), threadCount);
+
+	for (t=0; t<threadCount; t++) 
+	{
+		match2comb += works[t].match[2];
+		match3comb += works[t].match[3];
+		match4comb += works[t].match[4];
+		match5comb += works[t].match[5];
+		if (DRAW_BALL >= 6) match6comb += works[t].match[6];
+	}
+}
+
+
+
+void *matchCombWorker(void *arg)
+{
+	struct MatchCombWork *work = (struct MatchCombWork *) arg;
+	int i, j, n;
+	int common;
+
+	/* every count up to MAX_DRAW_BALL, the 5 ball games leave match[6] at 0 */
+	memset(work->match, 0, sizeof(work->match));
+
+	for (i=work->first; i<work->last; i++) 
+	{
+		for (j=i+1; j<drawHistory->count; j++) 
+		{
+			common = countCommon(&drawHistory->mask[i], &drawHistory->mask[j]);
+
+			for (n=2; n<=common; n++) {
+				work->match[n]++;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+
+
+void splitTriangle(int count, int parts, int *bounds)
+{
+	double total = (double) count*(count-1)/2;
+	double done = 0;
+	int i, t = 1;
+
+	bounds[0] = 0;
+
+	for (i=0; i<count && t<parts; i++) 
+	{
+		done += count-1-i;
+
+		while (t < parts && done >= total*t/parts) {
+			bounds[t++] = i+1;
+		}
+	}
+
+	while (t <= parts) {
+		bounds[t++] = count;
+	}
+}
+
+
+
+void runWorkers(void *(*worker)(void *), void *works, size_t workSize, int count)
+{
+	int i;
+#ifdef USE_THREADS
+	pthread_t threads[MAX_THREADS];
+	int started[MAX_THREADS];
+
+	if (count > 1) 
+	{
+		for (i=0; i<count; i++) {
+			started[i] = (pthread_create(&threads[i], NULL, worker, (char *) works + i*workSize) == 0);
+			if (!started[i]) worker((char *) works + i*workSize);
+		}
+
+		for (i=0; i<count; i++) {
+			if (started[i]) pthread_join(threads[i], NULL);
+		}
+
+		return;
+	}
+#endif
+
+	for (i=0; i<count; i++) {
+		worker((char *) works + i*workSize);
+	}
+}
+
+
+
+int getCpuCount()
+{
+	long count = 1;
+
+#if defined(USE_THREADS) && defined(_SC_NPROCESSORS_ONLN)
+	count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+	if (count < 1) count = 1;
+	if (count > MAX_THREADS) count = MAX_THREADS;
+
+	return (int) count;
+}
+
+
+
+void parseArgs(int argc, char *argv[])
+{
+	int i, g;
+	char *name = argv[0];
+
+	threadCount = getCpuCount();
+	rngSeed = (unsigned long) time(NULL);
+
+	/* the game in the program name (sayisal-linux, powerball-win64.exe), super lotto if there is none */
+	if (strrchr(name, '/')) name = strrchr(name, '/') + 1;
+	if (strrchr(name, '\\')) name = strrchr(name, '\\') + 1;
+
+	game = games[GAME_SUPER];
+
+	for (g=0; g<GAME_COUNT; g++) {
+		if (strstr(name, games[g].name)) game = games[g];
+	}
+
+	for (i=1; i<argc; i++) 
+	{
+		if (strcmp(argv[i], "--threads") == 0 && i+1 < argc) {
+			threadCount = atoi(argv[++i]);
+
+			if (threadCount < 1 || threadCount > MAX_THREADS) {
+				fprintf(stderr, "Thread count must be between 1-%d\n", MAX_THREADS);
+				exit(1);
+			}
+		} else if (strcmp(argv[i], "--game") == 0 && i+1 < argc) {
+			if ((g = findGame(argv[++i])) < 0) {
+				fprintf(stderr, "Game must be sayisal, super or powerball\n");
+				exit(1);
+			}
+
+			game = games[g];
+		} else if (strcmp(argv[i], "--seed") == 0 && i+1 < argc) {
+			rngSeed = strtoul(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--bloom") == 0) {
+			useBloom = 1;
+		} else if (strcmp(argv[i], "--no-cache") == 0) {
+			useCache = 0;
+		} else if (strcmp(argv[i], "--self-test") == 0) {
+			selfTest = 1;
+		} else if (strcmp(argv[i], "--time") == 0) {
+			printTime = 1;
+		} else if (strcmp(argv[i], "--batch") == 0 && i+1 < argc) {
+			batchCount = atol(argv[++i]);
+			printScreen = 0;
+
+			if (batchCount < 1) {
+				fprintf(stderr, "Batch coupon count must be greater than 0\n");
+				exit(1);
+			}
+		} else if (strcmp(argv[i], "--unique") == 0) {
+			batchUnique = 1;
+		} else if (strcmp(argv[i], "--strategy") == 0 && i+1 < argc) {
+			batchStrategy = parseStrategy(argv[++i]);
+
+			if (batchStrategy == 0) {
+				fprintf(stderr, "Strategy must be a comma separated list of date, norm, left, blend1, blend2, side, rand, lucky or all\n");
+				exit(1);
+			}
+		} else if (command == 0 && parseCommand(argv[i]) != 0) {
+			command = parseCommand(argv[i]);
+			printScreen = 0;
+		} else if (strcmp(argv[i], "--k") == 0 && i+1 < argc) {
+			commandK = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--count") == 0 && i+1 < argc) {
+			commandCount = atoi(argv[++i]);
+		} else if ((strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0) && i+1 < argc) {
+			commandOutput = argv[++i];
+		} else if (command == COMMAND_ADD && argv[i][0] != '-') {
+			/* the date and the numbers of the draw, a row of the statistics file */
+			if (strlen(commandRow) + strlen(argv[i]) + 2 > sizeof(commandRow)) {
+				fprintf(stderr, "The row of add-draw is too long\n");
+				exit(1);
+			}
+
+			if (commandRow[0]) strcat(commandRow, "\t");
+			strcat(commandRow, argv[i]);
+		} else if (strcmp(argv[i], "--rng") == 0 && i+1 < argc) {
+			i++;
+			if (strcmp(argv[i], "xoshiro") == 0) rngType = RNG_XOSHIRO;
+			else if (strcmp(argv[i], "libc") == 0) rngType = RNG_LIBC;
+			else {
+				fprintf(stderr, "Random number generator must be xoshiro or libc\n");
+				exit(1);
+			}
+		} else {
+			fprintf(stderr, "Usage: %s [stats | draw [--count N] | match [--k N] | lucky [--k N] | add-draw DATE N1 N2 ..] [-o FILE] [--game sayisal|super|powerball] [--threads N] [--seed N] [--rng xoshiro|libc] [--bloom] [--no-cache] [--self-test] [--time] [--batch N] [--strategy LIST] [--unique]\n", argv[0]);
+			exit(1);
+		}
+	}
+
+	if (command && batchCount) {
+		fprintf(stderr, "--batch can't be used with a command\n");
+		exit(1);
+	}
+
+	if (batchUnique && !batchCount) {
+		fprintf(stderr, "--unique is an option of --batch\n");
+		exit(1);
+	}
+
+	if (command == COMMAND_DRAW && (commandCount < 1 || commandCount > 50)) {
+		fprintf(stderr, "Draw count must be between 1-50\n");
+		exit(1);
+	}
+
+	if (command == COMMAND_MATCH && (commandK < 2 || commandK > DRAW_BALL)) {
+		fprintf(stderr, "Combination size of match must be between 2-%d\n", DRAW_BALL);
+		exit(1);
+	}
+
+	if (command == COMMAND_LUCKY && (commandK < 2 || commandK > 4)) {
+		fprintf(stderr, "Combination size of lucky must be between 2-4\n");
+		exit(1);
+	}
+
+	if (command == COMMAND_ADD && commandRow[0] == '\0') {
+		fprintf(stderr, "add-draw needs the date and the numbers of the draw (as a row of %s)\n", game.fileStats);
+		exit(1);
+	}
+}
+
+
+
+int parseStrategy(char *names)
+{
+	char buf[100];
+	char *name;
+	int strategy = 0;
+
+	strncpy(buf, names, sizeof(buf)-1);
+	buf[sizeof(buf)-1] = '\0';
+
+	for (name = strtok(buf, ","); name; name = strtok(NULL, ",")) 
+	{
+		if (strcmp(name, "date") == 0) strategy |= STRATEGY_DATE;
+		else if (strcmp(name, "norm") == 0) strategy |= STRATEGY_NORM;
+		else if (strcmp(name, "left") == 0) strategy |= STRATEGY_LEFT;
+		else if (strcmp(name, "blend1") == 0) strategy |= STRATEGY_BLEND1;
+		else if (strcmp(name, "blend2") == 0) strategy |= STRATEGY_BLEND2;
+		else if (strcmp(name, "side") == 0) strategy |= STRATEGY_SIDE;
+		else if (strcmp(name, "rand") == 0) strategy |= STRATEGY_RAND;
+		else if (strcmp(name, "lucky") == 0) strategy |= STRATEGY_LUCKY;
+		else if (strcmp(name, "all") == 0) strategy |= STRATEGY_ALL;
+		else return 0;
+	}
+
+	return strategy;
+}
+
+
+
+int findGame(char *name)
+{
+	int g;
+
+	for (g=0; g<GAME_COUNT; g++) {
+		if (strcmp(name, games[g].name) == 0) return g;
+	}
+
+	return -1;
+}
+
+
+
+int parseCommand(char *name)
+{
+	if (strcmp(name, "stats") == 0) return COMMAND_STATS;
+	if (strcmp(name, "draw") == 0) return COMMAND_DRAW;
+	if (strcmp(name, "match") == 0) return COMMAND_MATCH;
+	if (strcmp(name, "lucky") == 0) return COMMAND_LUCKY;
+	if (strcmp(name, "add-draw") == 0) return COMMAND_ADD;
+
+	return 0;
+}
+
+
+
+void runCommand(int cmd, FILE *fp, struct Rng *rng)
+{
+	struct ListXY *coupon = NULL;
+	struct ListXY *coupon_bonus = NULL;
+	struct ListXY *luckyBalls = NULL;
+
+	/* the draws take the balls in the order of the statistics, as from the main menu */
+	bubbleSortXByVal(winningBallStats, -1);
+	bubbleSortXByVal(bonusBallStats, -1);
+
+	if (cmd == COMMAND_STATS) 
+	{
+		fprintf(fp, "Which number drawn how many times? : \n\n");
+		printBallStats(winningBallStats, fp);
+		fprintf(fp, "\n\n");
+
+		if (TOTAL_BALL_BONUS) {
+			fprintf(fp, "Number of draws of %s : \n\n", game.bonusName);
+			printBallStats(bonusBallStats, fp);
+			fprintf(fp, "\n\n");
+		}
+
+		fprintf(fp, "Matched 2 combinations: %u\n", match2comb);
+		fprintf(fp, "Matched 3 combinations: %u\n", match3comb);
+		fprintf(fp, "Matched 4 combinations: %u\n", match4comb);
+		fprintf(fp, "Matched 5 combinations: %u\n", match5comb);
+	} 
+	else if (cmd == COMMAND_DRAW) 
+	{
+		coupon = createListXY(coupon);
+		coupon_bonus = createListXY(coupon_bonus);
+
+		/* coupon, totalDrawCount, date, norm, left, blend1, blend2, side, rand, lucky */
+		drawBalls(coupon, winningBallStats, drawArena, commandCount, 1, 1, 1, 1, 1, 1, 1, 1, rng);
+
+		if (TOTAL_BALL_BONUS) {
+			drawBonusBall(coupon_bonus, bonusBallStats, drawArena, commandCount, rng);
+			printListXYWithBonusByKey(coupon, coupon_bonus, fp);
+			removeAllXY(coupon_bonus);
+		} else {
+			printListXYByKey(coupon, fp);
+		}
+
+		if (useBloom) printBloomStats(combFilter);
+
+		removeAllXY(coupon);
+		releaseArena(drawArena);
+
+		free(coupon);
+		free(coupon_bonus);
+	} 
+	else if (cmd == COMMAND_MATCH) 
+	{
+		calcCombMatch(commandK, fp);
+	} 
+	else if (cmd == COMMAND_LUCKY) 
+	{
+		luckyBalls = createListXY(luckyBalls);
+		luckyBalls = getLuckyBalls(luckyBalls, commandK);
+		fprintf(fp, "Numbers that love each other (%d numbers):\n\n", commandK);
+		bubbleSortYByVal(luckyBalls, -1);
+		printLuckyBalls(luckyBalls, fp);
+		removeAllXY(luckyBalls);
+		free(luckyBalls);
+	} 
+	else if (cmd == COMMAND_ADD) 
+	{
+		if (!addDraw(commandRow, fp)) exit(1);
+	}
+}
+
+
+
+int addDraw(char *row, FILE *fp)
+{
+	int columns[MAX_DRAW_BALL+2];
+	unsigned int match[MAX_DRAW_BALL+1];
+	char *errorAt;
+	char error[80], date[11], line[256], number[12];
+	long drawDate;
+	int i, n, bonusBall, common;
+
+	if (!parseDrawLine(row, row + strlen(row), &drawDate, columns, &errorAt, error)) {
+		fprintf(stderr, "add-draw:%ld: %s\n", (long) (errorAt - row) + 1, error);
+		return 0;
+	}
+
+	if (drawHistory->count > 0 && drawDate <= drawHistory->date[0]) {
+		formatDate(drawHistory->date[0], date);
+		fprintf(stderr, "add-draw: the date must be after the last draw (%s)\n", date);
+		return 0;
+	}
+
+	bonusBall = game.bonusColumn ? columns[DRAW_BALL+game.bonusColumn-1] : 0;
+
+	/* the row of the statistics file, as the rows are written in it */
+	formatDate(drawDate, line);
+
+	for (i=0; i<DRAW_BALL+game.extraColumns; i++) {
+		sprintf(number, "\t%d", columns[i]);
+		strcat(line, number);
+	}
+
+	if (!prependStatsLine(fileStats, line)) {
+		fprintf(stderr, "add-draw: can't write %s\n", fileStats);
+		return 0;
+	}
+
+	prependDraw(drawHistory, columns, bonusBall, drawDate);
+
+	/* only the new draw is compared with the draws so far */
+	memset(match, 0, sizeof(match));
+
+	for (i=1; i<drawHistory->count; i++) 
+	{
+		common = countCommon(&drawHistory->mask[0], &drawHistory->mask[i]);
+
+		for (n=2; n<=common; n++) {
+			match[n]++;
+		}
+	}
+
+	match2comb += match[2];
+	match3comb += match[3];
+	match4comb += match[4];
+	match5comb += match[5];
+	if (DRAW_BALL >= 6) match6comb += match[6];
+
+	/* the ball statistics, the combination filter and the co-occurrence index are made from the cache at the next launch */
+	if (useCache) writeHistoryCache(drawHistory, fileStats, fileCache);
+
+	formatDate(drawDate, date);
+
+	fprintf(fp, "Draw of %s is added to %s (%d draws)\n\n", date, game.fileStats, drawHistory->count);
+	fprintf(fp, "%s\n\n", line);
+	fprintf(fp, "Matched 2 combinations: %u (+%u)\n", match2comb, match[2]);
+	fprintf(fp, "Matched 3 combinations: %u (+%u)\n", match3comb, match[3]);
+	fprintf(fp, "Matched 4 combinations: %u (+%u)\n", match4comb, match[4]);
+	fprintf(fp, "Matched 5 combinations: %u (+%u)\n", match5comb, match[5]);
+
+	return 1;
+}
+
+
+
+int prependStatsLine(char *fileName, char *line)
+{
+	char tempName[PATH_MAX+sizeof(TEMP_EXT)];
+	char *data, *ext, *eol;
+	long size;
+	FILE *fp;
+
+	data = mapFile(fileName, &size);
+
+	strcpy(tempName, fileName);
+	if ((ext = strrchr(tempName, '.')) != NULL && strchr(ext, PATH_SEPARATOR[0]) == NULL) *ext = '\0';
+	strcat(tempName, TEMP_EXT);
+
+	if ((fp = fopen(tempName, "wb")) == NULL) {
+		if (data) unmapFile(data, size);
+		return 0;
+	}
+
+	/* the line ends of the file (CRLF or LF) */
+	eol = data ? (char *) memchr(data, '\n', size) : NULL;
+	fprintf(fp, "%s%s", line, (eol && eol > data && eol[-1] == '\r') ? "\r\n" : "\n");
+
+	if (data) 
+	{
+		fwrite(data, 1, size, fp);
+		unmapFile(data, size);
+	}
+
+	if (fclose(fp) != 0) {
+		remove(tempName);
+		return 0;
+	}
+
+	/* rename replaces the file at once, the statistics file is never missing */
+	if (rename(tempName, fileName) == 0) return 1;
+
+#ifdef WIN32
+	/* rename does not replace an existing file on Windows, the new file is kept in tempName if this fails too */
+	if (remove(fileName) == 0 && rename(tempName, fileName) == 0) return 1;
+#endif
+
+	return 0;
+}
+
+
+
+double getTime()
+{
+#ifdef USE_THREADS
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+#else
+	return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+
+void calcCombMatch(int comb, FILE *fp)
+{
+	int i, j, k;
+	int found;
+	int lastDrawn = -1;
+	int screen = printScreen && comb >= 4;
+	unsigned char *aPrvDrawn1 = NULL;
+	unsigned char *aPrvDrawn2 = NULL;
+	char buf[100];
+	char date1[11], date2[11];
+	int d1, m1, y1;
+	int d2, m2, y2;
+
+	if (comb == 2 || comb == 3 || comb == 4 || comb == 5 || comb == 6) 
+	{
+		if (printScreen) printf("Matched combinations of numbers from previous draws:\n\n");
+		if (fp != NULL) fprintf(fp, "Matched combinations of numbers from previous draws:\n\n");
+
+		if (comb == 2) {
+			if (printScreen) printf("Matched 2 combinations: %u\n\n", match2comb);
+			if (fp != NULL) fprintf(fp, "Matched 2 combinations: %u\n\n", match2comb);
+		}
+		else if (comb == 3) {
+			if (printScreen) printf("Matched 3 combinations: %u\n\n", match3comb);
+			if (fp != NULL) fprintf(fp, "Matched 3 combinations: %u\n\n", match3comb);
+		}
+		else if (comb == 4) {
+			if (printScreen) printf("Matched 4 combinations: %u\n\n", match4comb);
+			if (fp != NULL) fprintf(fp, "Matched 4 combinations: %u\n\n", match4comb);
+		}
+		else if (comb == 5) {
+			if (printScreen) printf("Matched 5 combinations: %u\n\n", match5comb);
+			if (fp != NULL) fprintf(fp, "Matched 5 combinations: %u\n\n", match5comb);
+		}
+		else if (comb == 6) {
+			if (printScreen) printf("Matched 6 combinations: %u\n\n", match6comb);
+			if (fp != NULL) fprintf(fp, "Matched 6 combinations: %u\n\n", match6comb);
+		}
+
+		for (i=0; i<drawHistory->count; i++) 
+		{
+			aPrvDrawn1 = drawHistory->balls[i];
+
+			for (j=i+1; j<drawHistory->count; j++) 
+			{
+				aPrvDrawn2 = drawHistory->balls[j];
+				
+				if (comb == 2) {
+					found = search2CombX(aPrvDrawn2, aPrvDrawn1, buf);
+				}
+				else if (comb == 3) {
+					found = search3CombX(aPrvDrawn2, aPrvDrawn1, buf);
+				}
+				else if (comb == 4) {
+					found = search4CombX(aPrvDrawn2, aPrvDrawn1, buf);
+				}
+				else if (comb == 5) {
+					found = search5CombX(aPrvDrawn2, aPrvDrawn1, NULL);
+				}
+				else if (comb == 6) {
+					found = search6CombX(aPrvDrawn2, aPrvDrawn1);
+				}
+
+				if (found) 
+				{
+					formatDate(drawHistory->date[i], date1);
+					if (lastDrawn != i) {
+						if (screen) printf("\n-------------------------------------------------------------------------------------------------");
+						if (fp != NULL) fprintf(fp, "\n-------------------------------------------------------------------------------------------------");
+						if (screen) printf("\n\n%s : ", date1);
+						if (fp != NULL) fprintf(fp, "\n\n%s : ", date1);
+
+						if (comb >= 4) printRowByKey(aPrvDrawn1, 0, fp);
+						else  printRowByKey(aPrvDrawn1, 2, fp);
+
+						/* the rows of the games drawing fewer balls are padded to the width of MAX_DRAW_BALL balls */
+						for (k=DRAW_BALL; k<MAX_DRAW_BALL; k++) {
+							if (screen) printf("   ");
+							if (fp != NULL) fprintf(fp, "   ");
+						}
+
+						unpackDate(drawHistory->date[i], &d1, &m1, &y1);
+					}
+					else {
+						if (screen) printf("                               ");
+						if (fp != NULL) fprintf(fp, "                               ");
+					}
+
+					if (screen) printf("    ");
+					if (fp != NULL) fprintf(fp, "    ");
+
+					formatDate(drawHistory->date[j], date2);
+
+					if (screen) printf("%s : ", date2);
+					if (fp != NULL) fprintf(fp, "%s : ", date2);
+
+					if (comb >= 4) printRowByKey(aPrvDrawn2, 0, fp);
+					else  printRowByKey(aPrvDrawn2, 2, fp);
+
+					unpackDate(drawHistory->date[j], &d2, &m2, &y2);
+
+					if (screen) printf("   %4d days", dateDiff(d2, m2, y2, d1, m1, y1));
+					if (fp != NULL) fprintf(fp, "   %4d days", dateDiff(d2, m2, y2, d1, m1, y1));
+
+					if (comb != 5) {
+						if (screen) printf("   %s", buf);
+						if (fp != NULL) fprintf(fp, "   %s", buf);
+					}
+
+					if (screen) printf("\n");
+					if (fp != NULL) fprintf(fp, "\n");
+					lastDrawn = i;
+				}
+			}
+		}
+
+		if (screen) printf("\n-------------------------------------------------------------------------------------------------\n\n");
+		if (fp != NULL) fprintf(fp, "\n-------------------------------------------------------------------------------------------------\n\n");
+	}
+}
+
+
+
+struct CombFilter *createCombFilter(struct CombFilter *pf, int bitsComb)
+{
+	int comb;
+
+	pf = (struct CombFilter *) calloc(1, sizeof(struct CombFilter));
+	pf->bitsComb = bitsComb;
+
+	for (comb=1; comb<=bitsComb && comb<=DRAW_BALL; comb++) {
+		pf->bits[comb] = (unsigned long *) calloc((choose(TOTAL_BALL, comb) + MASK_WORD_BITS - 1) / MASK_WORD_BITS, sizeof(unsigned long));
+	}
+
+	return pf;
+}
+
+
+
+void freeCombFilter(struct CombFilter *pf)
+{
+	int comb;
+
+	for (comb=1; comb<=DRAW_BALL; comb++) {
+		if (comb <= FILTER_BITS_COMB) free(pf->bits[comb]);
+		free(pf->keys[comb]);
+
+		if (pf->bloom[comb]) {
+			free(pf->bloom[comb]->bits);
+			free(pf->bloom[comb]);
+		}
+	}
+
+	free(pf);
+}
+
+
+
+void addCombFilter(struct CombFilter *pf, unsigned char *row)
+{
+	int keys[MAX_DRAW_BALL+1];
+
+	getRowKeys(row, keys);
+	sortKeys(keys, DRAW_BALL);
+
+	addCombKeys(pf, keys, DRAW_BALL);
+}
+
+
+
+void addCombKeys(struct CombFilter *pf, int *keys, int count)
+{
+	long ranks[MAX_COMB_RANKS];
+	int i, n, comb;
+	long rank;
+
+	for (comb=1; comb<=count; comb++) 
+	{
+		n = rankCombs(keys, count, comb, ranks);
+
+		for (i=0; i<n; i++) 
+		{
+			rank = ranks[i];
+
+			if (comb <= pf->bitsComb) pf->bits[comb][rank / MASK_WORD_BITS] |= 1UL << (rank % MASK_WORD_BITS);
+			else putCombFilter(pf, comb, (unsigned long) rank + 1);
+
+			if (pf->bloom[comb]) putBloomFilter(pf->bloom[comb], (unsigned long) rank);
+		}
+	}
+}
+
+
+
+void addCombList(struct CombFilter *pf, struct ListX *pl)
+{
+	int keys[MAX_DRAW_BALL+1];
+	int count = length(pl);
+
+	if (count > DRAW_BALL) count = DRAW_BALL;
+
+	getKeys(pl, keys, 0, count);
+	sortKeys(keys, count);
+
+	addCombKeys(pf, keys, count);
+}
+
+
+
+struct CombFilter *getListFilter(struct ListXY *pl)
+{
+	int i;
+
+	if (pl->filter == NULL) {
+		pl->filter = createCombFilter(pl->filter, COUPON_BITS_COMB);
+
+		for (i=0; i<pl->length; i++) {
+			addCombList(pl->filter, pl->index[i]);
+		}
+	}
+
+	return pl->filter;
+}
+
+
+
+void putCombFilter(struct CombFilter *pf, int comb, unsigned long key)
+{
+	unsigned long *keys;
+	int i, size;
+
+	/* grow the hash set (keep it at most half full) */
+	if (2*(pf->used[comb]+1) > pf->size[comb]) 
+	{
+		keys = pf->keys[comb];
+		size = pf->size[comb];
+
+		pf->size[comb] = size ? size*2 : 1024;
+		pf->keys[comb] = (unsigned long *) calloc(pf->size[comb], sizeof(unsigned long));
+
+		for (i=0; i<size; i++) {
+			if (keys[i]) pf->keys[comb][combSlot(pf->keys[comb], pf->size[comb], keys[i])] = keys[i];
+		}
+
+		free(keys);
+	}
+
+	i = combSlot(pf->keys[comb], pf->size[comb], key);
+
+	if (pf->keys[comb][i] == 0) {
+		pf->keys[comb][i] = key;
+		pf->used[comb]++;
+	}
+}
+
+
+
+int testCombFilter(struct CombFilter *pf, int *keys, int count, int comb)
+{
+	long ranks[MAX_COMB_RANKS];
+	int i, n;
+	long rank;
+	struct BloomFilter *bloom;
+
+	if (comb < 1 || comb > DRAW_BALL || count < comb) return 0;
+
+	bloom = pf->bloom[comb];
+
+	n = rankCombs(keys, count, comb, ranks);
+
+	for (i=0; i<n; i++) 
+	{
+		rank = ranks[i];
+
+		/* most combinations have never been drawn, the Bloom filter rejects them without touching the sets */
+		if (bloom && !testBloomFilter(bloom, (unsigned long) rank)) continue;
+
+		if (comb <= pf->bitsComb) {
+			if (pf->bits[comb][rank / MASK_WORD_BITS] & (1UL << (rank % MASK_WORD_BITS))) return 1;
+		}
+		else if (pf->size[comb]) {
+			if (pf->keys[comb][combSlot(pf->keys[comb], pf->size[comb], (unsigned long) rank + 1)]) return 1;
+		}
+
+		if (bloom) bloom->falseHits++;
+	}
+
+	return 0;
+}
+
+
+
+struct BloomFilter *createBloomFilter(struct BloomFilter *pb, long keyCount)
+{
+	unsigned long words = 1;
+
+	while (words * MASK_WORD_BITS < (unsigned long) keyCount * BLOOM_BITS_PER_KEY) {
+		words *= 2;
+	}
+
+	pb = (struct BloomFilter *) calloc(1, sizeof(struct BloomFilter));
+	pb->bits = (unsigned long *) calloc(words, sizeof(unsigned long));
+	pb->words = words;
+
+	return pb;
+}
+
+
+
+void putBloomFilter(struct BloomFilter *pb, unsigned long key)
+{
+	unsigned long bits;
+	unsigned long word = bloomWord(pb, key, &bits);
+
+	pb->bits[word] |= bits;
+}
+
+
+
+int testBloomFilter(struct BloomFilter *pb, unsigned long key)
+{
+	unsigned long bits;
+	unsigned long word = bloomWord(pb, key, &bits);
+
+	pb->queries++;
+
+	if ((pb->bits[word] & bits) != bits) return 0;
+
+	pb->hits++;
+
+	return 1;
+}
+
+
+
+unsigned long bloomWord(struct BloomFilter *pb, unsigned long key, unsigned long *bits)
+{
+	unsigned long long h = (unsigned long long) key + 0x9E3779B97F4A7C15ULL;
+	int i;
+
+	/* splitmix64 finalizer: the low bits select the word, the high bits select the bits in the word */
+	h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+	h = h ^ (h >> 31);
+
+	*bits = 0;
+
+	for (i=0; i<BLOOM_HASHES; i++) {
+		*bits |= 1UL << ((h >> (32 + 8*i)) % MASK_WORD_BITS);
+	}
+
+	return (unsigned long) h & (pb->words - 1);
+}
+
+
+
+void printBloomStats(struct CombFilter *pf)
+{
+	struct BloomFilter *pb;
+	unsigned long negatives;
+	int comb;
+
+	printf("\nBloom filters of the drawn combinations:\n\n");
+
+	for (comb=2; comb<=DRAW_BALL; comb++) 
+	{
+		pb = pf->bloom[comb];
+
+		if (pb == NULL || pb->queries == 0) continue;
+
+		negatives = pb->queries - pb->hits + pb->falseHits;
+
+		printf("%d numbers: %lu lookups, %lu rejected, %lu false positives (%.2f%%), %lu KB\n", comb, pb->queries, 
+			pb->queries - pb->hits, pb->falseHits, negatives ? 100.0 * pb->falseHits / negatives : 0.0, 
+			pb->words * sizeof(unsigned long) / 1024);
+	}
+
+	printf("\n");
+}
+
+
+
+void sortKeys(int *keys, int count)
+{
+	int i, j, key;
+
+	for (i=1; i<count; i++) 
+	{
+		key = keys[i];
+		for (j=i-1; j>=0 && keys[j] > key; j--) keys[j+1] = keys[j];
+		keys[j+1] = key;
+	}
+}
+
+
+
+void initLuckyDraw()
+{
+	struct CombCount *counts = NULL;
+	int keys[2];
+	int ball, partner;
+
+	if (luckyDraw2 != NULL) return;
+
+	luckyDraw2 = createListXY(luckyDraw2);
+	luckyDraw2 = getLuckyBalls(luckyDraw2, 2);
+
+	luckyDraw2Sorted = createListXY(luckyDraw2Sorted);
+	luckyDraw2Sorted = getLuckyBalls(luckyDraw2Sorted, 2);
+
+	luckyDraw3Sorted = createListXY(luckyDraw3Sorted);
+	luckyDraw3Sorted = getLuckyBalls(luckyDraw3Sorted, 3);
+
+	bubbleSortYByVal(luckyDraw2Sorted, -1);
+	bubbleSortYByVal(luckyDraw3Sorted, -1);
+
+	counts = getLuckyCounts(luckyIndex, 2);
+
+	for (ball=1; ball<=TOTAL_BALL; ball++) 
+	{
+		luckyPartnerCount[ball] = 0;
+
+		for (partner=1; partner<=TOTAL_BALL; partner++) 
+		{
+			if (partner == ball) continue;
+
+			keys[0] = (ball < partner) ? ball : partner;
+			keys[1] = (ball < partner) ? partner : ball;
+
+			if (counts[rankComb(keys, 2)].count >= MIN_LUCKY) luckyPartners[ball][luckyPartnerCount[ball]++] = partner;
+		}
+	}
+}
+
+
+
+void drawBallsByLucky(struct ListXY *coupon, struct Arena *pa, int drawNum, int totalDrawCount, struct Rng *rng)
+{
+	int i, j, k;
+	int tries = 0;
+	int index;
+	int ind1, ind2, ind3;
+	int ball1, ball2, ball3;
+	char label[30];
+	struct ListXY *luckyBalls2 = NULL;
+	struct ListXY *luckyBalls2Sorted = NULL;
+	struct ListXY *luckyBalls3Sorted = NULL;
+	struct ListX *luckyRow2 = NULL;
+	struct ListX *luckyRow3 = NULL;
+	struct ListX *drawRow = NULL;
+	/* a lucky double combination must have been drawn together in at least minLucky draws */
+	int minLucky = MIN_LUCKY;
+
+	initLuckyDraw();
+
+	luckyBalls2 = luckyDraw2;
+	luckyBalls2Sorted = luckyDraw2Sorted;
+	luckyBalls3Sorted = luckyDraw3Sorted;
+
+	for (i=0; i<3;) 
+	{
+		if (i == 0) strcpy(label, "(lucky 3)");
+		else if (i == 1) strcpy(label, "(2 of lucky 3)");
+		else strcpy(label, "(lucky 2)");
+
+		if (i == 0) k = 3;
+		else k = 2;
+   		drawRow = createListXIn(pa, NULL, label, 0);
+		if (i < 2) {
+			luckyRow3 = getListXByIndex(luckyBalls3Sorted, randRng(rng, 10));
+			ind1 = randRng(rng, 3);
+			if (ind1 == 0) {
+				ind2 = randRng(rng, 2) +1;
+				if (ind2 == 1) ind3 = 2;
+				else ind3 = 1;
+			}
+			else if (ind1 == 1) {
+				ind2 = 0;
+				ind3 = 2;
+			}
+			else {
+				ind2 = randRng(rng, 2);
+				if (ind2 == 0) ind3 = 1;
+				else ind3 = 0;
+			}
+			ball1 = getKey(luckyRow3, ind1);
+			ball2 = getKey(luckyRow3, ind2);
+			ball3 = getKey(luckyRow3, ind3);
+			appendItem(drawRow, ball1);
+			if (i == 0) appendItem(drawRow, ball2);
+			appendItem(drawRow, ball3);
+		} else {
+			if (i < 2) {
+				luckyRow2 = getListXByIndex(luckyBalls2Sorted, randRng(rng, 10));
+			} else {
+				do {
+					index = randRng(rng, lengthY(luckyBalls2));
+					luckyRow2 = getListXByIndex(luckyBalls2, index);
+				} while (luckyRow2->val < minLucky);
+				//} while (0);
+			}
+			ind1 = randRng(rng, 2);
+			if (ind1 == 0) ind2 = 1;
+			else ind2 = 0;
+			ball1 = getKey(luckyRow2, ind1);
+			ball2 = getKey(luckyRow2, ind2);
+			appendItem(drawRow, ball1);
+			appendItem(drawRow, ball2);
+		}
+
+		for (j=0; j<DRAW_BALL-k; j++)
+		{
+			if (luckyPartnerCount[ball2] == 0) break;
+
+			/* the next ball is a lucky partner of the last one (a lucky double combination containing it) */
+			do {
+				ball2 = luckyPartners[ball2][randRng(rng, luckyPartnerCount[ball2])];
+			} while (seqSearchX1(drawRow, ball2) >= 0);
+
+			appendItem(drawRow, ball2);
+		}
+
+		/* the last ball has no lucky partner, the row is drawn again */
+		if (length(drawRow) < DRAW_BALL) {
+			freeListX(drawRow);
+			continue;
+		}
+		
+		if (lengthY(coupon) < ceil(totalDrawCount/3)) {
+			if (search2CombXY(coupon, drawRow) && ++tries < 49) {
+				freeListX(drawRow);
+				continue;
+			}
+			else i++;
+		} else if (lengthY(coupon) >= ceil(totalDrawCount/3) && lengthY(coupon) < 2*ceil(totalDrawCount/3)) {
+			if (search3CombXY(coupon, drawRow) && ++tries < 49) {
+				freeListX(drawRow);
+				continue;
+			}
+			else i++;
+		} else {
+			if (search4CombXY(coupon, drawRow) && ++tries < 49) {
+				freeListX(drawRow);
+				continue;
+			}
+			else i++;
+		}
+
+		/* after 49 rows sharing combinations with the coupon the last one is taken, as in the other draws */
+		tries = 0;
 		
-				appendItems(lb, keys);
+		bubbleSortXByKey(drawRow);
+		if (i == drawNum) appendList(coupon, drawRow);
+	}
+}
+
+
+
+void drawBalls(struct ListXY *coupon, struct ListX *ballStats, struct Arena *pa, int totalDrawCount, int drawByDate, int drawByNorm, int drawByLeft, int drawByBlend1, int drawByBlend2, int drawBySide, int drawByRand, int drawByLucky, struct Rng *rng)
+{
+	int i;
+	int found = 0;
+	int matchComb = 0;
+	int elimComb = 0;
+	int autoCalc = 1;
+	int noMatch, noElim;
+	char label[30];
+	int drawCount = totalDrawCount;
+	int drawnDate = 0;
+
+	struct ListX *drawnBallsDate1 = NULL;
+	struct ListX *drawnBallsDate2 = NULL;
+	struct ListX *drawnBallsNorm = NULL;
+	struct ListX *drawnBallsLeft = NULL;
+	struct ListX *drawnBallsBlend1 = NULL;
+	struct ListX *drawnBallsBlend2 = NULL;
+	struct ListX *drawnBallsSide = NULL;
+	struct ListX *drawnBallsRand = NULL;
+
+startDraw:
+
+	if (drawByDate && !drawnDate) 
+	{
+		strcpy(label, "(date 1)");
+		drawnBallsDate1 = createListXIn(pa, NULL, label, 0);
+		strcpy(label, "(date 2)");
+		drawnBallsDate2 = createListXIn(pa, NULL, label, 0);
+
+		drawBallByDate(drawnBallsDate1, drawnBallsDate2, ballStats, rng);
+
+		if (drawCount) {
+			appendList(coupon, drawnBallsDate1);
+			drawCount--;
+		}
+
+		if (drawCount) {
+			appendList(coupon, drawnBallsDate2);
+			drawCount--;
+		}
+
+		drawnDate = 1;
+	}
+
+	
+	/* normal distribution */
+	if (drawByNorm && drawCount) 
+	{
+		strcpy(label, "(normal distribution)");
+		drawnBallsNorm = createListXIn(pa, NULL, label, 0);
+
+		if (autoCalc) {
+			matchComb = 0;
+			elimComb = 2;
+		}
+
+		for (i=0; i<49; i++) 
+		{
+			drawnBallsNorm = drawBallByNorm(drawnBallsNorm, ballStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb, rng);
+
+			if (matchComb) noMatch = !findComb(drawnBallsNorm, matchComb);
+			else noMatch = 0;
+
+			if (elimComb) noElim = findComb(drawnBallsNorm, elimComb);
+			else noElim = 0;
+
+			if (!(noMatch || noElim)) {
+				if (i < 20) {
+					found = search1BallXY(coupon, drawnBallsNorm, DRAW_BALL);
+				} else if (i < 30) {
+					found = search2CombXY(coupon, drawnBallsNorm);
+				} else if (i < 40) {
+					found = search3CombXY(coupon, drawnBallsNorm);
+				} else {
+					found = search4CombXY(coupon, drawnBallsNorm);
+				}
+
+				if(!found) break;
+			}
+
+			if (autoCalc) {
+				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
+				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
+				else {matchComb = 0; elimComb = 0;}
+			}
+		}
+
+		appendList(coupon, drawnBallsNorm);
+		drawCount--;
+	}
+
+
+	/* Blend 1 */
+	if (drawByBlend1 && drawCount) 
+	{
+		strcpy(label, "(blend 1)");
+		drawnBallsBlend1 = createListXIn(pa, NULL, label, 0);
+
+		if (autoCalc) {
+			matchComb = 0;
+			elimComb = 2;
+		}
+
+		for (i=0; i<49; i++) 
+		{
+			drawnBallsBlend1 = drawBallByBlend1(drawnBallsBlend1, ballStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb, rng);
+
+			if (matchComb) noMatch = !findComb(drawnBallsBlend1, matchComb);
+			else noMatch = 0;
+
+			if (elimComb) noElim = findComb(drawnBallsBlend1, elimComb);
+			else noElim = 0;
+
+			if (!(noMatch || noElim)) {
+				if (i < 20) {
+					found = search1BallXY(coupon, drawnBallsBlend1, DRAW_BALL);
+				} else if (i < 30) {
+					found = search2CombXY(coupon, drawnBallsBlend1);
+				} else if (i < 40) {
+					found = search3CombXY(coupon, drawnBallsBlend1);
+				} else {
+					found = search4CombXY(coupon, drawnBallsBlend1);
+				}
+
+				if(!found) break;
+			}
+
+			if (autoCalc) {
+				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
+				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
+				else {matchComb = 0; elimComb = 0;}
+			}
+		}
+
+		appendList(coupon, drawnBallsBlend1);
+		drawCount--;
+	}
+
+
+	/* Blend 2 */
+	if (drawByBlend2 && drawCount) 
+	{
+		strcpy(label, "(blend 2)");
+		drawnBallsBlend2 = createListXIn(pa, NULL, label, 0);
+
+		if (autoCalc) {
+			matchComb = 0;
+			elimComb = 2;
+		}
+
+		for (i=0; i<49; i++) 
+		{
+			drawnBallsBlend2 = drawBallByBlend2(drawnBallsBlend2, ballStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb, rng);
+
+			if (matchComb) noMatch = !findComb(drawnBallsBlend2, matchComb);
+			else noMatch = 0;
+
+			if (elimComb) noElim = findComb(drawnBallsBlend2, elimComb);
+			else noElim = 0;
+
+			if (!(noMatch || noElim)) {
+				if (i < 20) {
+					found = search1BallXY(coupon, drawnBallsBlend2, DRAW_BALL);
+				} else if (i < 30) {
+					found = search2CombXY(coupon, drawnBallsBlend2);
+				} else if (i < 40) {
+					found = search3CombXY(coupon, drawnBallsBlend2);
+				} else {
+					found = search4CombXY(coupon, drawnBallsBlend2);
+				}
+
+				if(!found) break;
+			}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+			if (autoCalc) {
+				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
+				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
+				else {matchComb = 0; elimComb = 0;}
 			}
 		}
-		found=1;
+
+		appendList(coupon, drawnBallsBlend2);
+		drawCount--;
 	}
 
-	if (seqSearchX3(aPrvDrawn, b1, b2, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b2, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b2, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b5;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+	/* Left Stacked */
+	if (drawByLeft && drawCount) 
+	{
+		strcpy(label, "(left stacked)");
+		drawnBallsLeft = createListXIn(pa, NULL, label, 0);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		if (autoCalc) {
+			matchComb = 0;
+			elimComb = 2;
 		}
-		found=1;
-	}
 
-	if (seqSearchX3(aPrvDrawn, b1, b2, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b2, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b2, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		for (i=0; i<49; i++) 
+		{
+			drawnBallsLeft = drawBallByLeft(drawnBallsLeft, ballStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb, rng);
 
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+			if (matchComb) noMatch = !findComb(drawnBallsLeft, matchComb);
+			else noMatch = 0;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+			if (elimComb) noElim = findComb(drawnBallsLeft, elimComb);
+			else noElim = 0;
 
-	if (seqSearchX3(aPrvDrawn, b1, b3, b4) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b3, b4);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b3, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+			if (!(noMatch || noElim)) {
+				if (i < 20) {
+					found = search1BallXY(coupon, drawnBallsLeft, DRAW_BALL);
+				} else if (i < 30) {
+					found = search2CombXY(coupon, drawnBallsLeft);
+				} else if (i < 40) {
+					found = search3CombXY(coupon, drawnBallsLeft);
+				} else {
+					found = search4CombXY(coupon, drawnBallsLeft);
+				}
 
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = b4;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+				if(!found) break;
+			}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+			if (autoCalc) {
+				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
+				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
+				else {matchComb = 0; elimComb = 0;}
 			}
 		}
-		found=1;
+
+		appendList(coupon, drawnBallsLeft);
+		drawCount--;
 	}
 
-	if (seqSearchX3(aPrvDrawn, b1, b3, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b3, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b3, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = b5;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+	/* Side Stacked */
+	if (drawBySide && drawCount) 
+	{
+		strcpy(label, "(side stacked)");
+		drawnBallsSide = createListXIn(pa, NULL, label, 0);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		if (autoCalc) {
+			matchComb = 0;
+			elimComb = 2;
 		}
-		found=1;
-	}
 
-	if (seqSearchX3(aPrvDrawn, b1, b3, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b3, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b3, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		for (i=0; i<49; i++) 
+		{
+			drawnBallsSide = drawBallBySide(drawnBallsSide, ballStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb, rng);
 
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+			if (matchComb) noMatch = !findComb(drawnBallsSide, matchComb);
+			else noMatch = 0;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+			if (elimComb) noElim = findComb(drawnBallsSide, elimComb);
+			else noElim = 0;
 
-	if (seqSearchX3(aPrvDrawn, b1, b4, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b4, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+			if (!(noMatch || noElim)) {
+				if (i < 20) {
+					found = search1BallXY(coupon, drawnBallsSide, DRAW_BALL);
+				} else if (i < 30) {
+					found = search2CombXY(coupon, drawnBallsSide);
+				} else if (i < 40) {
+					found = search3CombXY(coupon, drawnBallsSide);
+				} else {
+					found = search4CombXY(coupon, drawnBallsSide);
+				}
 
-				keys[0] = b1;
-				keys[1] = b4;
-				keys[2] = b5;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+				if(!found) break;
+			}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+			if (autoCalc) {
+				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
+				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
+				else {matchComb = 0; elimComb = 0;}
 			}
 		}
-		found=1;
+
+		appendList(coupon, drawnBallsSide);
+		drawCount--;
 	}
 
-	if (seqSearchX3(aPrvDrawn, b1, b4, b6) >= 0)
+
+	/* Random */
+	if (drawByRand && drawCount) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b4, b6);
-			strcat(buf, fStr);
+		strcpy(label, "(random)");
+		drawnBallsRand = createListXIn(pa, NULL, label, 0);
+
+		if (autoCalc) {
+			matchComb = 0;
+			elimComb = 2;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b1;
-				keys[1] = b4;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		for (i=0; i<49; i++) 
+		{
+			drawnBallsRand = drawBallByRand(drawnBallsRand, ballStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb, rng);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+			if (matchComb) noMatch = !findComb(drawnBallsRand, matchComb);
+			else noMatch = 0;
 
-	if (seqSearchX3(aPrvDrawn, b1, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b1, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b1, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+			if (elimComb) noElim = findComb(drawnBallsRand, elimComb);
+			else noElim = 0;
 
-				keys[0] = b1;
-				keys[1] = b5;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+			if (!(noMatch || noElim)) {
+				if (i < 20) {
+					found = search1BallXY(coupon, drawnBallsRand, DRAW_BALL);
+				} else if (i < 30) {
+					found = search2CombXY(coupon, drawnBallsRand);
+				} else if (i < 40) {
+					found = search3CombXY(coupon, drawnBallsRand);
+				} else {
+					found = search4CombXY(coupon, drawnBallsRand);
+				}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+				if(!found) break;
+			}
+
+			if (autoCalc) {
+				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
+				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
+				else {matchComb = 0; elimComb = 0;}
 			}
 		}
-		found=1;
+
+		appendList(coupon, drawnBallsRand);
+		drawCount--;
 	}
 
-	if (seqSearchX3(aPrvDrawn, b2, b3, b4) >= 0)
+
+	/* Lucky */
+	if (drawByLucky && drawCount) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b2, b3, b4);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b2, b3, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		drawBallsByLucky(coupon, pa, randRng(rng, 3)+1, totalDrawCount, rng);
+		drawCount--;
+	}
 
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = b4;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+	if (drawCount) goto startDraw;
+}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX3(aPrvDrawn, b2, b3, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b2, b3, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b2, b3, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = b5;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+void drawBonusBall(struct ListXY *coupon, struct ListX *ballStats, struct Arena *pa, int drawCount, struct Rng *rng)
+{
+	int i, j;
+	int found = 0;
+	char label[30];
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+	struct ListX *drawnBalls = NULL;
+
+	strcpy(label, game.bonusLabel);
 
-	if (seqSearchX3(aPrvDrawn, b2, b3, b6) >= 0)
+	for (i=0; i<drawCount; i++) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b2, b3, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b2, b3, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		drawnBalls = createListXIn(pa, NULL, label, 0);
 
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		for (j=0; j<6; j++) 
+		{
+			drawnBalls = drawBallByNorm(drawnBalls, ballStats, TOTAL_BALL_BONUS, 1, 0, 0, rng);
+			found = search1BallXY(coupon, drawnBalls, 1);
+			if(!found) break;
+		}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+		if (found) {
+			for (j=0; j<6; j++) 
+			{
+				drawnBalls = drawBallByRand(drawnBalls, ballStats, TOTAL_BALL_BONUS, 1, 0, 0, rng);
+				found = search1BallXY(coupon, drawnBalls, 1);
+				if(!found) break;
 			}
 		}
-		found=1;
-	}
 
-	if (seqSearchX3(aPrvDrawn, b2, b4, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b2, b4, b5);
-			strcat(buf, fStr);
+		if (found) {
+			for (j=0; j<6; j++) 
+			{
+				drawnBalls = drawBallByBlend1(drawnBalls, ballStats, TOTAL_BALL_BONUS, 1, 0, 0, rng);
+				found = search1BallXY(coupon, drawnBalls, 1);
+				if(!found) break;
+			}
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b2, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b2;
-				keys[1] = b4;
-				keys[2] = b5;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		if (found) {
+			for (j=0; j<6; j++) 
+			{
+				drawnBalls = drawBallByBlend2(drawnBalls, ballStats, TOTAL_BALL_BONUS, 1, 0, 0, rng);
+				found = search1BallXY(coupon, drawnBalls, 1);
+				if(!found) break;
+			}
+		}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+		if (found) {
+			for (j=0; j<6; j++) 
+			{
+				drawnBalls = drawBallByNorm(drawnBalls, ballStats, TOTAL_BALL_BONUS, 1, 0, 0, rng);
+				found = search1BallXY(coupon, drawnBalls, 1);
+				if(!found) break;
 			}
 		}
-		found=1;
+
+		appendList(coupon, drawnBalls);
 	}
+}
 
-	if (seqSearchX3(aPrvDrawn, b2, b4, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b2, b4, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b2, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b2;
-				keys[1] = b4;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+int drawBatch(long count, int strategy, int unique, FILE *fp, char *fileName, struct Rng *rng)
+{
+	struct DrawWork works[MAX_THREADS];
+	struct CombFilter *written = NULL;
+	struct CombFilter *older = NULL;
+	int threads = threadCount;
+	int t, c, chunks, maxChunk, chunkStrategy, retry = 0;
+	int drawDate = (strategy & STRATEGY_DATE) != 0;
+	long row = 1, first, next, drawn, left = count;
+	double start = getTime(), elapsed;
 
-	if (seqSearchX3(aPrvDrawn, b2, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b2, b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b2, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+	/* rand() has one state for the process and the Bloom filters count the lookups in shared counters */
+	if (rng->type == RNG_LIBC || useBloom) threads = 1;
 
-				keys[0] = b2;
-				keys[1] = b5;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+	/* the rows written in the batch, by the rank of their DRAW_BALL combination (hash set only) */
+	written = createCombFilter(written, 0);
+
+	/* built before the threads start, the threads only read them */
+	if (strategy & STRATEGY_LUCKY) initLuckyDraw();
+
+	memset(works, 0, sizeof(works));
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+	fprintf(fp, "%s\n\n", game.couponHeader);
 
-	if (seqSearchX3(aPrvDrawn, b3, b4, b5) >= 0)
+	for (t=0; t<threads; t++) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b3, b4, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b3, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		/* thread t draws with mainRng jumped ahead t times (2^64 numbers apart) */
+		works[t].rng = *rng;
+		for (c=0; c<t; c++) jumpRng(&works[t].rng);
 
-				keys[0] = b3;
-				keys[1] = b4;
-				keys[2] = b5;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		works[t].arena = createArena(works[t].arena);
+		works[t].ballStats = copyListX(winningBallStats);
+		works[t].ballStatsBonus = TOTAL_BALL_BONUS ? copyListX(bonusBallStats) : NULL;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		for (c=0; c<BATCH_ROUND; c++) {
+			works[t].coupons[c] = createListXY(works[t].coupons[c]);
+			works[t].couponsBonus[c] = works[t].ballStatsBonus ? createListXY(works[t].couponsBonus[c]) : NULL;
 		}
-		found=1;
 	}
 
-	if (seqSearchX3(aPrvDrawn, b3, b4, b6) >= 0)
+	while (left > 0) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b3, b4, b6);
-			strcat(buf, fStr);
+		/* chunk c of the round is drawn by thread c % threads */
+		for (t=0; t<threads; t++) {
+			works[t].count = 0;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b3, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b3;
-				keys[1] = b4;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		for (chunks=0, drawn=0; chunks < threads*BATCH_ROUND && left > 0; chunks++) 
+		{
+			/* the date rows are the same for a day, they are drawn once, in the first chunk */
+			chunkStrategy = drawDate ? strategy : (strategy & ~STRATEGY_DATE);
+			if (chunkStrategy == 0) break;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+			/* the date draw alone gives 2 rows */
+			maxChunk = (chunkStrategy == STRATEGY_DATE) ? 2 : BATCH_CHUNK;
+
+			t = chunks % threads;
+			works[t].rows[works[t].count] = (left < maxChunk) ? (int) left : maxChunk;
+			works[t].strategies[works[t].count] = chunkStrategy;
+			drawn += works[t].rows[works[t].count];
+			left -= works[t].rows[works[t].count++];
+			drawDate = 0;
 		}
-		found=1;
-	}
 
-	if (seqSearchX3(aPrvDrawn, b3, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b3, b5, b6);
-			strcat(buf, fStr);
+		/* only the date strategy was selected and its rows are written, it gives no more rows */
+		if (chunks == 0) {
+			left = 0;
+			break;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b3, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b3;
-				keys[1] = b5;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		runWorkers(drawWorker, works, sizeof(struct DrawWork), (chunks < threads) ? chunks : threads);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+		/* the rows written before are skipped, they are drawn again in the next round */
+		for (c=0, first=row; c<chunks; c++) 
+		{
+			t = c % threads;
+			next = writeCoupon(works[t].coupons[c/threads], works[t].couponsBonus[c/threads], row, written, older, fp);
+			left += works[t].rows[c/threads] - (next - row);
+			row = next;
+
+			/* the window moves by a generation, the rows of the oldest generation may be written again */
+			if (!unique && written->used[DRAW_BALL] >= BATCH_WINDOW) 
+			{
+				if (older) freeCombFilter(older);
+				older = written;
+				written = createCombFilter(NULL, 0);
 			}
+
+			if (works[t].couponsBonus[c/threads]) removeAllXY(works[t].couponsBonus[c/threads]);
+			removeAllXY(works[t].coupons[c/threads]);
 		}
-		found=1;
-	}
 
-	if (seqSearchX3(aPrvDrawn, b4, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d,%2d)", b4, b5, b6);
-			strcat(buf, fStr);
+		for (t=0; t<threads; t++) {
+			releaseArena(works[t].arena);
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY3(luckyBalls, b4, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b4;
-				keys[1] = b5;
-				keys[2] = b6;
-				keys[3] = '\0';
-		
-				appendItems(lb, keys);
+		/* the rows of the round were mostly written before, the strategies may be running out of new rows */
+		retry = ((row - first) * BATCH_YIELD < drawn) ? retry + 1 : 0;
+		if (retry == BATCH_RETRY) break;
+	}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+	elapsed = getTime() - start;
+
+	printf("%ld coupons are written to %s file in %.2f seconds (%.0f coupons/sec, %d threads)\n", row - 1, fileName, elapsed, 
+		elapsed > 0 ? (row - 1) / elapsed : 0.0, threads);
+
+	if (left > 0) fprintf(stderr, "The strategies give few new rows, %ld of %ld coupons are written\n", row - 1, count);
+
+	freeCombFilter(written);
+	if (older) freeCombFilter(older);
+
+	for (t=0; t<threads; t++) 
+	{
+		for (c=0; c<BATCH_ROUND; c++) {
+			free(works[t].coupons[c]);
+			free(works[t].couponsBonus[c]);
 		}
-		found=1;
+
+		freeListX(works[t].ballStats);
+		if (works[t].ballStatsBonus) freeListX(works[t].ballStatsBonus);
+		free(works[t].arena);
 	}
 
-	return found;
+	return left <= 0;
 }
 
 
 
-int search2CombXY(struct ListXY *prvDrawnsList, struct ListX *drawnBalls)
+void *drawWorker(void *arg)
 {
-	int i;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	struct ListX *aPrvDrawn = NULL;
-	int found = 0;
+	struct DrawWork *work = (struct DrawWork *) arg;
+	int strategy;
+	int c;
 
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
+	for (c=0; c<work->count; c++) 
+	{
+		strategy = work->strategies[c];
 
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
+		drawBalls(work->coupons[c], work->ballStats, work->arena, work->rows[c], (strategy & STRATEGY_DATE) != 0, 
+			(strategy & STRATEGY_NORM) != 0, (strategy & STRATEGY_LEFT) != 0, (strategy & STRATEGY_BLEND1) != 0, 
+			(strategy & STRATEGY_BLEND2) != 0, (strategy & STRATEGY_SIDE) != 0, (strategy & STRATEGY_RAND) != 0, 
+			(strategy & STRATEGY_LUCKY) != 0, &work->rng);
 
-	for (i=0; i<lengthY(prvDrawnsList); i++) 
-	{
-		aPrvDrawn = getListXByIndex(prvDrawnsList, i);
-
-		if (seqSearchX2(aPrvDrawn, b1, b2) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b1, b3) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b1, b4) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b1, b5) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b1, b6) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b2, b3) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b2, b4) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b2, b5) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b2, b6) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b3, b4) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b3, b5) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b3, b6) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b4, b5) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b4, b6) >= 0) {found=1; break;}
-		if (seqSearchX2(aPrvDrawn, b5, b6) >= 0) {found=1; break;}
+		if (work->ballStatsBonus) drawBonusBall(work->couponsBonus[c], work->ballStatsBonus, work->arena, work->rows[c], &work->rng);
 	}
 
-	return found;
+	return NULL;
 }
 
 
 
-int search2CombX(struct ListX *aPrvDrawn, struct ListX *drawnBalls, struct ListXY *luckyBalls, char *buf)
+long writeCoupon(struct ListXY *coupon, struct ListXY *coupon_bonus, long first, struct CombFilter *written, struct CombFilter *older, FILE *fp)
 {
-	struct ListX *lb = NULL;
-	int index;
-	int keys[DRAW_BALL+1];
-	int b1, b2, b3, b4, b5, b6;
-	int found = 0;
-	char fStr[20];
-
-	getKeys(drawnBalls, keys, 0, DRAW_BALL);
-
-	b1 = keys[0];
-	b2 = keys[1];
-	b3 = keys[2];
-	b4 = keys[3];
-	b5 = keys[4];
-	b6 = keys[5];
-
-	if (buf) buf[0] = '\0';
+	struct ListX *nl1 = coupon->list;
+	struct ListX *nl2 = coupon_bonus ? coupon_bonus->list : NULL;
+	struct Item *pt;
+	int keys[MAX_DRAW_BALL+1];
 
-	if (seqSearchX2(aPrvDrawn, b1, b2) >= 0)
+	for (; (nl1); nl1 = nl1->next) 
 	{
-		if (buf) {
-			sprintf(fStr, "(%2d,%2d)", b1, b2);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b1, b2)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b2;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+		if (written) 
+		{
+			getKeys(nl1, keys, 0, DRAW_BALL);
+			sortKeys(keys, DRAW_BALL);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+			/* the row is written before, skip it (with its bonus ball) */
+			if (testCombFilter(written, keys, DRAW_BALL, DRAW_BALL) || (older && testCombFilter(older, keys, DRAW_BALL, DRAW_BALL))) {
+				if (nl2) nl2 = nl2->next;
+				continue;
 			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b1, b3) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b1, b3);
-			strcat(buf, fStr);
+			putCombFilter(written, DRAW_BALL, (unsigned long) rankComb(keys, DRAW_BALL) + 1);
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b1, b3)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b1;
-				keys[1] = b3;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+		fprintf(fp, "%2ld - ", first++);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		for (pt = nl1->head; (pt); pt = pt->next) {
+			fprintf(fp, "%2d ", pt->key);
 		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b1, b4) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b1, b4);
-			strcat(buf, fStr);
+		if (nl2) {
+			fprintf(fp, "  %2d ", nl2->head->key);
+			nl2 = nl2->next;
+			if (nl1->label) fprintf(fp, "     %s", nl1->label);
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b1, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b1;
-				keys[1] = b4;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
-
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		else if (nl1->label) {
+			fprintf(fp, "  %s", nl1->label);
 		}
-		found=1;
+
+		fprintf(fp, "\n");
 	}
 
-	if (seqSearchX2(aPrvDrawn, b1, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b1, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b1, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+	return first;
+}
 
-				keys[0] = b1;
-				keys[1] = b5;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b1, b6) >= 0)
+int getDrawnBallsList(struct DrawHistory *history, char *fileName)
+{
+	int columns[MAX_DRAW_BALL+2];
+	long size, date, lineNo;
+	char *data, *line, *end, *eol, *p, *errorAt;
+	char error[80];
+	struct stat st;
+
+	if ((data = mapFile(fileName, &size)) == NULL) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b1, b6);
-			strcat(buf, fStr);
+		/* an empty file can't be mapped, it has no draws */
+		if (stat(fileName, &st) != 0) {
+			fprintf(stderr, "%s file not found!\n", fileName);
+			return 0;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b1, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b1;
-				keys[1] = b6;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
-
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+		return 1;
 	}
 
-	if (seqSearchX2(aPrvDrawn, b2, b3) >= 0)
+	end = data + size;
+
+	for (line = data, lineNo = 1; line < end; line = eol + 1, lineNo++) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b2, b3);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b2, b3)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		if ((eol = (char *) memchr(line, '\n', end - line)) == NULL) eol = end;
 
-				keys[0] = b2;
-				keys[1] = b3;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+		/* blank lines are skipped */
+		for (p = line; p < eol && (*p == ' ' || *p == '\t' || *p == '\r'); p++);
+		if (p == eol) continue;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		if (!parseDrawLine(line, eol, &date, columns, &errorAt, error)) {
+			fprintf(stderr, "%s:%ld:%ld: %s\n", fileName, lineNo, (long) (errorAt - line) + 1, error);
+			continue;
 		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b2, b4) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b2, b4);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b2, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		appendDraw(history, columns, game.bonusColumn ? columns[DRAW_BALL+game.bonusColumn-1] : 0, date);
+	}
 
-				keys[0] = b2;
-				keys[1] = b4;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+	unmapFile(data, size);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+	return 1;
+}
 
-	if (seqSearchX2(aPrvDrawn, b2, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b2, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b2, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b2;
-				keys[1] = b5;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
-	}
+int parseDrawLine(char *line, char *end, long *date, int *columns, char **errorAt, char *error)
+{
+	char *p = line, *q;
+	long dmy[3], value;
+	char seen[MAX_TOTAL_BALL+1];
+	int i;
 
-	if (seqSearchX2(aPrvDrawn, b2, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b2, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b2, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+	while (p < end && (*p == ' ' || *p == '\t')) p++;
 
-				keys[0] = b2;
-				keys[1] = b6;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+	*errorAt = p;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+	/* dd.mm.yyyy or mm/dd/yyyy, any separator */
+	for (i=0; i<3; i++) 
+	{
+		if (i > 0) 
+		{
+			if (p == end || (*p >= '0' && *p <= '9') || *p == ' ' || *p == '\t' || *p == '\r') {
+				*errorAt = p;
+				strcpy(error, "expected a date separator");
+				return 0;
 			}
+
+			p++;
 		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b3, b4) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b3, b4);
-			strcat(buf, fStr);
+		if ((q = parseNumber(p, end, &dmy[i])) == NULL) {
+			*errorAt = p;
+			strcpy(error, (game.dateFormat == DATE_MDY) ? "expected a date (mm/dd/yyyy)" : "expected a date (dd.mm.yyyy)");
+			return 0;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b3, b4)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b3;
-				keys[1] = b4;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+		p = q;
+	}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+	if (game.dateFormat == DATE_MDY) {
+		value = dmy[0];
+		dmy[0] = dmy[1];
+		dmy[1] = value;
 	}
 
-	if (seqSearchX2(aPrvDrawn, b3, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b3, b5);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b3, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+	if (dmy[0] < 1 || dmy[0] > 31 || dmy[1] < 1 || dmy[1] > 12 || dmy[2] < 1 || dmy[2] > 9999) {
+		strcpy(error, "invalid date");
+		return 0;
+	}
 
-				keys[0] = b3;
-				keys[1] = b5;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+	*date = packDate((int) dmy[0], (int) dmy[1], (int) dmy[2]);
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+	/* a day past the end of the month (31.04, 29.02 of a common year) does not survive the round trip through the day number */
+	if (dayDate(dayNumber(*date)) != *date) {
+		strcpy(error, "invalid date");
+		return 0;
 	}
 
-	if (seqSearchX2(aPrvDrawn, b3, b6) >= 0)
+	memset(seen, 0, sizeof(seen));
+
+	/* winning numbers and the extra columns of the game (joker, bonus ball) */
+	for (i=0; i<DRAW_BALL+game.extraColumns; i++) 
 	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b3, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b3, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		while (p < end && (*p == ' ' || *p == '\t')) p++;
 
-				keys[0] = b3;
-				keys[1] = b6;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+		*errorAt = p;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		if (p == end || *p == '\r') {
+			sprintf(error, "expected %d numbers after the date, found %d", DRAW_BALL+game.extraColumns, i);
+			return 0;
 		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b4, b5) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b4, b5);
-			strcat(buf, fStr);
+		if ((q = parseNumber(p, end, &value)) == NULL) {
+			strcpy(error, "expected a number");
+			return 0;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b4, b5)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
 
-				keys[0] = b4;
-				keys[1] = b5;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+		if (i < DRAW_BALL) 
+		{
+			if (value < 1 || value > TOTAL_BALL) {
+				sprintf(error, "ball %ld is out of range 1-%d", value, TOTAL_BALL);
+				return 0;
+			}
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
+			if (seen[value]) {
+				sprintf(error, "ball %ld is repeated", value);
+				return 0;
 			}
-		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b4, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b4, b6);
-			strcat(buf, fStr);
+			seen[value] = 1;
 		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b4, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
-
-				keys[0] = b4;
-				keys[1] = b6;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
-
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
+		else if (i == DRAW_BALL+game.bonusColumn-1 && value > TOTAL_BALL_BONUS) {
+			/* 0 if the bonus ball was not drawn yet (the early draws of the sayisal lotto) */
+			sprintf(error, "%s %ld is out of range 0-%d", game.bonusLabel, value, TOTAL_BALL_BONUS);
+			return 0;
 		}
-		found=1;
-	}
 
-	if (seqSearchX2(aPrvDrawn, b5, b6) >= 0)
-	{
-		if (buf) {
-			if (found) strcat(buf, ", ");
-			sprintf(fStr, "(%2d,%2d)", b5, b6);
-			strcat(buf, fStr);
-		}
-		if (luckyBalls) {
-			if ((index = seqSearchXY2(luckyBalls, b5, b6)) < 0) {
-				lb = createListX(lb, NULL, NULL, 1);
+		columns[i] = (int) value;
+		p = q;
+	}
 
-				keys[0] = b5;
-				keys[1] = b6;
-				keys[2] = '\0';
-		
-				appendItems(lb, keys);
+	while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
 
-				appendList(luckyBalls, lb);
-			} else {
-				incValXY(luckyBalls, index);
-			}
-		}
-		found=1;
+	if (p < end) {
+		*errorAt = p;
+		strcpy(error, "unexpected text after the numbers");
+		return 0;
 	}
 
-	return found;
+	return 1;
 }
 
 
 
-int search1BallXY(struct ListXY *couponList, struct ListX *drawnBalls, int drawBall)
+char *parseNumber(char *p, char *end, long *value)
 {
-	int i, j;
-	struct ListX *aPrvDrawn = NULL;
-	int balls[DRAW_BALL+1];
-	int found = 0;
+	long n = 0;
 
-	getKeys(drawnBalls, balls, 0, drawBall);
-
-	for (i=0; i<lengthY(couponList); i++) 
-	{
-		aPrvDrawn = getListXByIndex(couponList, i);
+	if (p == end || *p < '0' || *p > '9') return NULL;
 
-		for (j=0; j<drawBall; j++) {
-			if (seqSearchX1(aPrvDrawn, balls[j]) >= 0) {found=1; break;}
-		}
-		if (found) break;
+	for (; p < end && *p >= '0' && *p <= '9'; p++) {
+		if (n < 100000000L) n = n*10 + (*p - '0');
+		else n = 999999999L;
 	}
 
-	return found;
+	*value = n;
+
+	return p;
 }
 
 
 
-void init()
+int loadDrawHistory(struct DrawHistory *history, char *fileName, char *cacheName)
 {
-	int err;
-	char realPath[PATH_MAX];
-	cwd = (char *) malloc(sizeof(char)*PATH_MAX);
-	fileStats = (char *) malloc(sizeof(char)*PATH_MAX);
-	outputFile = (char *) malloc(sizeof(char)*PATH_MAX);
-
-	fileStats[0] = '\0';
-	outputFile[0] = '\0';
-
-#if defined(__linux__) || defined(__unix__) || defined(__APPLE__) || defined(SOLARIS) || defined(WIN32)
-	err = get_app_path(realPath, PATH_MAX);
-	if (err) puts("App path lookup failed!");
-	else {
-		cwd = dirname(realPath);
+	if (cacheName && readHistoryCache(history, fileName, cacheName)) return 1;
 
-		strcat(fileStats, cwd);
-		strcat(fileStats, PATH_SEPARATOR);
-		strcat(outputFile, cwd);
-		strcat(outputFile, PATH_SEPARATOR);
-	}
-#endif
+	return getDrawnBallsList(history, fileName) ? 0 : -1;
+}
 
-	strcat(fileStats, FILESTATS);
-	strcat(outputFile, OUTPUTFILE);
 
-	winningDrawnBallsList = createListXY(winningDrawnBallsList);
-	superStarDrawnBallsList = createListXY(superStarDrawnBallsList);
 
-	getDrawnBallsList(winningDrawnBallsList, superStarDrawnBallsList, fileStats);
+int readHistoryCache(struct DrawHistory *history, char *fileName, char *cacheName)
+{
+	struct HistoryCache header;
+	struct stat source;
+	char *data;
+	long size, i, day;
+	unsigned char *balls, *bonus;
+	int j, keys[MAX_DRAW_BALL+1];
 
-	winningBallStats = createListX(winningBallStats, NULL, NULL, 0);
-	superStarBallStats = createListX(superStarBallStats, NULL, NULL, 0);
-	getDrawnBallsStats(winningDrawnBallsList, superStarDrawnBallsList, winningBallStats, superStarBallStats);
+	if (stat(fileName, &source) != 0) return 0;
 
-	calcMatchCombCount();
+	if ((data = mapFile(cacheName, &size)) == NULL) return 0;
 
-	clearScreen();
-}
+	if (size < (long) sizeof(header)) {
+		unmapFile(data, size);
+		return 0;
+	}
 
+	memcpy(&header, data, sizeof(header));
 
+	/* stale if the statistics file has changed since the cache was written */
+	if (memcmp(header.magic, CACHE_MAGIC, 4) != 0 || header.version != CACHE_VERSION || header.game != findGame(game.name) 
+		|| header.drawBall != DRAW_BALL || header.sourceSize != (long) source.st_size || header.sourceTime != (long) source.st_mtime 
+		|| header.count < 0 || size != (long) sizeof(header) + header.count * (long) (sizeof(long) + MAX_DRAW_BALL + 1)) 
+	{
+		unmapFile(data, size);
+		return 0;
+	}
 
-struct ListXY * getLuckyBalls(struct ListXY *luckyBalls, int comb)
-{
-	int i, j;
-	struct ListX *aPrvDrawn1 = NULL;
-	struct ListX *aPrvDrawn2 = NULL;
+	balls = (unsigned char *) data + sizeof(header) + header.count * sizeof(long);
+	bonus = balls + header.count * MAX_DRAW_BALL;
 
-	if (comb == 2 || comb == 3 || comb == 4) 
+	for (i=0; i<header.count; i++) 
 	{
-		for (i=0; i<lengthY(winningDrawnBallsList); i++) 
-		{
-			aPrvDrawn1 = getListXByIndex(winningDrawnBallsList, i);
-
-			for (j=i+1; j<lengthY(winningDrawnBallsList); j++) 
-			{
-				aPrvDrawn2 = getListXByIndex(winningDrawnBallsList, j);
-				
-				if (comb == 2) {
-					search2CombX(aPrvDrawn2, aPrvDrawn1, luckyBalls, NULL);
-				}
-				else if (comb == 3) {
-					search3CombX(aPrvDrawn2, aPrvDrawn1, luckyBalls, NULL);
-				}
-				else if (comb == 4) {
-					search4CombX(aPrvDrawn2, aPrvDrawn1, luckyBalls, NULL);
-				}
-			}
+		memcpy(&day, data + sizeof(header) + i * sizeof(long), sizeof(long));
+
+		for (j=0; j<DRAW_BALL; j++) {
+			keys[j] = balls[i*MAX_DRAW_BALL + j];
 		}
+
+		appendDraw(history, keys, bonus[i], dayDate(day));
 	}
 
-	return luckyBalls;
-}
+	unmapFile(data, size);
 
+	match2comb = header.match[2];
+	match3comb = header.match[3];
+	match4comb = header.match[4];
+	match5comb = header.match[5];
+	match6comb = header.match[6];
 
+	return 1;
+}
 
-void calcMatchCombCount()
-{
-	int i, j;
-	struct ListX *aPrvDrawn1 = NULL;
-	struct ListX *aPrvDrawn2 = NULL;
 
-	printf("Initializing... Please wait.\n");
 
-	for (i=0; i<lengthY(winningDrawnBallsList); i++) 
-	{
-		aPrvDrawn1 = getListXByIndex(winningDrawnBallsList, i);
+void writeHistoryCache(struct DrawHistory *history, char *fileName, char *cacheName)
+{
+	struct HistoryCache header;
+	struct stat source;
+	long i, day;
+	FILE *fp;
 
-		for (j=i+1; j<lengthY(winningDrawnBallsList); j++) 
-		{
-			aPrvDrawn2 = getListXByIndex(winningDrawnBallsList, j);
+	if (stat(fileName, &source) != 0) return;
 
-			match2comb += search2CombX(aPrvDrawn2, aPrvDrawn1, NULL, NULL);
-			match3comb += search3CombX(aPrvDrawn2, aPrvDrawn1, NULL, NULL);
-			match4comb += search4CombX(aPrvDrawn2, aPrvDrawn1, NULL, NULL);
-			match5comb += search5CombX(aPrvDrawn2, aPrvDrawn1, NULL);
-			match6comb += search6CombX(aPrvDrawn2, aPrvDrawn1);
-		}
+	for (i=0; i<history->count; i++) {
+		if (dayDate(dayNumber(history->date[i])) != history->date[i]) return;
 	}
-}
 
+	if ((fp = fopen(cacheName, "wb")) == NULL) return;
 
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CACHE_MAGIC, 4);
+	header.version = CACHE_VERSION;
+	header.game = findGame(game.name);
+	header.drawBall = DRAW_BALL;
+	header.count = history->count;
+	header.sourceSize = (long) source.st_size;
+	header.sourceTime = (long) source.st_mtime;
+	header.match[2] = match2comb;
+	header.match[3] = match3comb;
+	header.match[4] = match4comb;
+	header.match[5] = match5comb;
+	header.match[6] = match6comb;
 
-void calcCombMatch(int comb, FILE *fp)
-{
-	int i, j;
-	int found;
-	struct ListX *aPrvDrawn1 = NULL;
-	struct ListX *aPrvDrawn2 = NULL;
-	char buf[100];
-	char date1[11], date2[11];
-	char lastDate[11];
-	int d1, m1, y1;
-	int d2, m2, y2;
-	char *ds1, *ms1, *ys1;
-	char *ds2, *ms2, *ys2;
+	fwrite(&header, sizeof(header), 1, fp);
 
-	if (comb == 2 || comb == 3 || comb == 4 || comb == 5 || comb == 6) 
-	{
-		printf("Matched combinations of numbers from previous draws:\n\n");
-		if (fp != NULL) fprintf(fp, "Matched combinations of numbers from previous draws:\n\n");
+	for (i=0; i<history->count; i++) {
+		day = dayNumber(history->date[i]);
+		fwrite(&day, sizeof(long), 1, fp);
+	}
 
-		if (comb == 2) {
-			printf("Matched 2 combinations: %u\n\n", match2comb);
-			if (fp != NULL) fprintf(fp, "Matched 2 combinations: %u\n\n", match2comb);
-		}
-		else if (comb == 3) {
-			printf("Matched 3 combinations: %u\n\n", match3comb);
-			if (fp != NULL) fprintf(fp, "Matched 3 combinations: %u\n\n", match3comb);
-		}
-		else if (comb == 4) {
-			printf("Matched 4 combinations: %u\n\n", match4comb);
-			if (fp != NULL) fprintf(fp, "Matched 4 combinations: %u\n\n", match4comb);
-		}
-		else if (comb == 5) {
-			printf("Matched 5 combinations: %u\n\n", match5comb);
-			if (fp != NULL) fprintf(fp, "Matched 5 combinations: %u\n\n", match5comb);
-		}
-		else if (comb == 6) {
-			printf("Matched 6 combinations: %u\n\n", match6comb);
-			if (fp != NULL) fprintf(fp, "Matched 6 combinations: %u\n\n", match6comb);
-		}
+	fwrite(history->balls, MAX_DRAW_BALL, history->count, fp);
+	fwrite(history->bonusBall, 1, history->count, fp);
 
-		for (i=0; i<lengthY(winningDrawnBallsList); i++) 
-		{
-			aPrvDrawn1 = getListXByIndex(winningDrawnBallsList, i);
+	/* a cache that is not written completely must not be read */
+	if (fclose(fp) != 0) remove(cacheName);
+}
 
-			for (j=i+1; j<lengthY(winningDrawnBallsList); j++) 
-			{
-				aPrvDrawn2 = getListXByIndex(winningDrawnBallsList, j);
-				
-				if (comb == 2) {
-					found = search2CombX(aPrvDrawn2, aPrvDrawn1, NULL, buf);
-				}
-				else if (comb == 3) {
-					found = search3CombX(aPrvDrawn2, aPrvDrawn1, NULL, buf);
-				}
-				else if (comb == 4) {
-					found = search4CombX(aPrvDrawn2, aPrvDrawn1, NULL, buf);
-				}
-				else if (comb == 5) {
-					found = search5CombX(aPrvDrawn2, aPrvDrawn1, NULL);
-				}
-				else if (comb == 6) {
-					found = search6CombX(aPrvDrawn2, aPrvDrawn1);
-				}
 
-				if (found) 
-				{
-					strcpy(date1, aPrvDrawn1->date);
-					if (strcmp(lastDate, date1) != 0) {
-						if (comb >= 4) printf("\n-------------------------------------------------------------------------------------------------");
-						if (fp != NULL) fprintf(fp, "\n-------------------------------------------------------------------------------------------------");
-						if (comb >= 4) printf("\n\n%s : ", date1);
-						if (fp != NULL) fprintf(fp, "\n\n%s : ", date1);
 
-						if (comb >= 4) printListXByKey(aPrvDrawn1, 0, fp);
-						else  printListXByKey(aPrvDrawn1, 2, fp);
+char *mapFile(char *fileName, long *size)
+{
+	char *data;
 
-						ds1 = strtok(date1, ".");
-						ms1 = strtok(NULL, ".");
-						ys1 = strtok(NULL, ".");
+#ifdef USE_MMAP
+	struct stat st;
+	int fd;
 
-						d1 = atoi(ds1);
-						m1 = atoi(ms1);
-						y1 = atoi(ys1);
+	*size = 0;
 
-						strcpy(date1, aPrvDrawn1->date);
-					}
-					else {
-						if (comb >= 4) printf("                               ");
-						if (fp != NULL) fprintf(fp, "                               ");
-					}
+	if ((fd = open(fileName, O_RDONLY)) < 0) return NULL;
 
-					if (comb >= 4) printf("    ");
-					if (fp != NULL) fprintf(fp, "    ");
+	if (fstat(fd, &st) != 0 || st.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
 
-					strcpy(date2, aPrvDrawn2->date);
+	data = (char *) mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
 
-					if (comb >= 4) printf("%s : ", date2);
-					if (fp != NULL) fprintf(fp, "%s : ", date2);
+	if (data == (char *) MAP_FAILED) return NULL;
 
-					if (comb >= 4) printListXByKey(aPrvDrawn2, 0, fp);
-					else  printListXByKey(aPrvDrawn2, 2, fp);
+	*size = (long) st.st_size;
+#else
+	FILE *fp;
 
-					ds2 = strtok(date2, ".");
-					ms2 = strtok(NULL, ".");
-					ys2 = strtok(NULL, ".");
+	*size = 0;
 
-					d2 = atoi(ds2);
-					m2 = atoi(ms2);
-					y2 = atoi(ys2);
+	if ((fp = fopen(fileName, "rb")) == NULL) return NULL;
 
-					if (comb >= 4) printf("   %4d days", dateDiff(d2, m2, y2, d1, m1, y1));
-					if (fp != NULL) fprintf(fp, "   %4d days", dateDiff(d2, m2, y2, d1, m1, y1));
+	fseek(fp, 0, SEEK_END);
+	*size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
 
-					if (comb != 5) {
-						if (comb >= 4) printf("   %s", buf);
-						if (fp != NULL) fprintf(fp, "   %s", buf);
-					}
+	if (*size <= 0 || (data = (char *) malloc(*size)) == NULL || fread(data, 1, *size, fp) != (size_t) *size) 
+	{
+		if (*size > 0) free(data);
+		fclose(fp);
+		*size = 0;
+		return NULL;
+	}
 
-					if (comb >= 4) printf("\n");
-					if (fp != NULL) fprintf(fp, "\n");
-					strcpy(lastDate, date1);
-				}
-			}
-		}
+	fclose(fp);
+#endif
 
-		if (comb >= 4) printf("\n-------------------------------------------------------------------------------------------------\n\n");
-		if (fp != NULL) fprintf(fp, "\n-------------------------------------------------------------------------------------------------\n\n");
-	}
+	return data;
 }
 
 
 
-void drawBallsByLucky(struct ListXY *coupon, int drawNum, int totalDrawCount)
+void unmapFile(char *data, long size)
 {
-	int i, j, k;
-	int index;
-	int ind1, ind2, ind3;
-	int ball1, ball2, ball3;
-	char label[30];
-	struct ListXY *luckyBalls2 = NULL;
-	struct ListXY *luckyBalls3 = NULL;
-	struct ListXY *luckyBalls2Sorted = NULL;
-	struct ListXY *luckyBalls3Sorted = NULL;
-	struct ListX *luckyRow2 = NULL;
-	struct ListX *luckyRow3 = NULL;
-	struct ListX *drawRow = NULL;
-
-	luckyBalls2 = createListXY(luckyBalls2);
-	luckyBalls2 = getLuckyBalls(luckyBalls2, 2);
+#ifdef USE_MMAP
+	munmap(data, size);
+#else
+	free(data);
+#endif
+}
 
-	luckyBalls2Sorted = createListXY(luckyBalls2Sorted);
-	luckyBalls2Sorted = getLuckyBalls(luckyBalls2Sorted, 2);
 
-	luckyBalls3 = createListXY(luckyBalls3);
-	luckyBalls3 = getLuckyBalls(luckyBalls3, 3);
 
-	luckyBalls3Sorted = createListXY(luckyBalls3Sorted);
-	luckyBalls3Sorted = getLuckyBalls(luckyBalls3Sorted, 3);
+void getDrawnBallsListXY(struct DrawHistory *history, struct ListXY * winningDrawnBallsList, struct ListXY * bonusDrawnBallsList)
+{
+	int i;
+	int keys[MAX_DRAW_BALL+1];
+	char date[11];
 
-	bubbleSortYByVal(luckyBalls2Sorted, -1);
-	bubbleSortYByVal(luckyBalls3Sorted, -1);
+	struct ListX *drawList = NULL;
 
-	for (i=0; i<3;) 
+	for (i=0; i<history->count; i++)
 	{
-		if (i == 0) strcpy(label, "(lucky 3)");
-		else if (i == 1) strcpy(label, "(2 of lucky 3)");
-		else strcpy(label, "(lucky 2)");
+		formatDate(history->date[i], date);
 
-		if (i == 0) k = 3;
-		else k = 2;
-   		drawRow = createListX(drawRow, NULL, label, 0);
-		if (i < 2) {
-			luckyRow3 = getListXByIndex(luckyBalls3Sorted, rand()%10);
-			ind1 = rand()%3;
-			if (ind1 == 0) {
-				ind2 = rand()%2 +1;
-				if (ind2 == 1) ind3 = 2;
-				else ind3 = 1;
-			}
-			else if (ind1 == 1) {
-				ind2 = 0;
-				ind3 = 2;
-			}
-			else {
-				ind2 = rand()%2;
-				if (ind2 == 0) ind3 = 1;
-				else ind3 = 0;
-			}
-			ball1 = getKey(luckyRow3, ind1);
-			ball2 = getKey(luckyRow3, ind2);
-			ball3 = getKey(luckyRow3, ind3);
-			appendItem(drawRow, ball1);
-			if (i == 0) appendItem(drawRow, ball2);
-			appendItem(drawRow, ball3);
-		} else {
-			if (i < 2) {
-				luckyRow2 = getListXByIndex(luckyBalls2Sorted, rand()%10);
-			} else {
-				do {
-					index = rand() % lengthY(luckyBalls2);
-					luckyRow2 = getListXByIndex(luckyBalls2, index);
-				} while (luckyRow2->val < ceil(180/TOTAL_BALL)+1);
-				//} while (0);
-			}
-			ind1 = rand()%2;
-			if (ind1 == 0) ind2 = 1;
-			else ind2 = 0;
-			ball1 = getKey(luckyRow2, ind1);
-			ball2 = getKey(luckyRow2, ind2);
-			appendItem(drawRow, ball1);
-			appendItem(drawRow, ball2);
-		}
+		drawList = createListX(drawList, date, NULL, 0);
+		getRowKeys(history->balls[i], keys);
+		appendItems(drawList, keys);
+		appendList(winningDrawnBallsList, drawList);
 
-		for (j=0; j<DRAW_BALL-k; j++)
-		{
-			do {
-				do {
-					index = rand() % lengthY(luckyBalls2);
-					luckyRow2 = getListXByIndex(luckyBalls2, index);
-				} while ((ind1 = seqSearchX1(luckyRow2, ball2)) < 0 || luckyRow2->val < ceil(180/TOTAL_BALL)+1);
-				//} while ((ind1 = seqSearchX1(luckyRow2, ball2)) < 0 );
-				if (ind1 == 0) ind2 = 1;
-				else ind2 = 0;
-				ball2 = getKey(luckyRow2, ind2);
-			} while (seqSearchX1(drawRow, ball2) >= 0);
-			appendItem(drawRow, ball2);
-		}
-		
-		if (lengthY(coupon) < ceil(totalDrawCount/3)) {
-			if (search2CombXY(coupon, drawRow)) {
-				removeAllX(drawRow);
-				free(drawRow);
-				continue;
-			}
-			else i++;
-		} else if (lengthY(coupon) >= ceil(totalDrawCount/3) && lengthY(coupon) < 2*ceil(totalDrawCount/3)) {
-			if (search3CombXY(coupon, drawRow)) {
-				removeAllX(drawRow);
-				free(drawRow);
-				continue;
-			}
-			else i++;
-		} else {
-			if (search4CombXY(coupon, drawRow)) {
-				removeAllX(drawRow);
-				free(drawRow);
-				continue;
-			}
-			else i++;
+		if (TOTAL_BALL_BONUS) {
+			drawList = createListX(drawList, date, NULL, 0);
+			appendItem(drawList, history->bonusBall[i]);
+			appendList(bonusDrawnBallsList, drawList);
 		}
-		
-		bubbleSortXByKey(drawRow);
-		if (i == drawNum) appendList(coupon, drawRow);
 	}
 }
 
 
 
-void drawBalls(struct ListXY *coupon, int totalDrawCount, int drawByDate, int drawByNorm, int drawByLeft, int drawByBlend1, int drawByBlend2, int drawBySide, int drawByRand, int drawByLucky)
+struct DrawHistory *createDrawHistory(struct DrawHistory *ph)
 {
-	int i;
-	int found = 0;
-	int matchComb = 0;
-	int elimComb = 0;
-	int autoCalc = 1;
-	int noMatch, noElim;
-	char label[30];
-	int drawCount = totalDrawCount;
-	int drawnDate = 0;
+	ph = (struct DrawHistory *) malloc(sizeof(struct DrawHistory));
+	ph->count = 0;
+	ph->size = 0;
+	ph->balls = NULL;
+	ph->mask = NULL;
+	ph->bonusBall = NULL;
+	ph->date = NULL;
+
+	return ph;
+}
 
-	struct ListX *drawnBallsDate1 = NULL;
-	struct ListX *drawnBallsDate2 = NULL;
-	struct ListX *drawnBallsNorm = NULL;
-	struct ListX *drawnBallsLeft = NULL;
-	struct ListX *drawnBallsBlend1 = NULL;
-	struct ListX *drawnBallsBlend2 = NULL;
-	struct ListX *drawnBallsSide = NULL;
-	struct ListX *drawnBallsRand = NULL;
 
-startDraw:
 
-	if (drawByDate && !drawnDate) 
-	{
-		strcpy(label, "(date 1)");
-		drawnBallsDate1 = createListX(drawnBallsDate1, NULL, label, 0);
-		strcpy(label, "(date 2)");
-		drawnBallsDate2 = createListX(drawnBallsDate2, NULL, label, 0);
+void appendDraw(struct DrawHistory *ph, int *keys, int bonusBall, long date)
+{
+	int i;
 
-		drawBallByDate(drawnBallsDate1, drawnBallsDate2, winningBallStats);
+	if (ph->count == ph->size) {
+		ph->size = ph->size ? ph->size*2 : 256;
+		ph->balls = (unsigned char (*)[MAX_DRAW_BALL]) realloc(ph->balls, sizeof(unsigned char)*MAX_DRAW_BALL*ph->size);
+		ph->mask = (struct BallMask *) realloc(ph->mask, sizeof(struct BallMask)*ph->size);
+		ph->bonusBall = (unsigned char *) realloc(ph->bonusBall, sizeof(unsigned char)*ph->size);
+		ph->date = (long *) realloc(ph->date, sizeof(long)*ph->size);
+	}
 
-		if (drawCount) {
-			appendList(coupon, drawnBallsDate1);
-			drawCount--;
-		}
+	for (i=0; i<MAX_DRAW_BALL; i++) {
+		ph->balls[ph->count][i] = (unsigned char) (i < DRAW_BALL ? keys[i] : 0);
+	}
 
-		if (drawCount) {
-			appendList(coupon, drawnBallsDate2);
-			drawCount--;
-		}
+	getRowMask(ph->balls[ph->count], &ph->mask[ph->count]);
 
-		drawnDate = 1;
-	}
+	ph->bonusBall[ph->count] = (unsigned char) bonusBall;
+	ph->date[ph->count] = date;
+	ph->count++;
+}
 
-	
-	/* normal distribution */
-	if (drawByNorm && drawCount) 
-	{
-		strcpy(label, "(normal distribution)");
-		drawnBallsNorm = createListX(drawnBallsNorm, NULL, label, 0);
 
-		if (autoCalc) {
-			matchComb = 0;
-			elimComb = 2;
-		}
 
-		for (i=0; i<49; i++) 
-		{
-			drawnBallsNorm = drawBallByNorm(drawnBallsNorm, winningBallStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb);
+void prependDraw(struct DrawHistory *ph, int *keys, int bonusBall, long date)
+{
+	unsigned char balls[MAX_DRAW_BALL];
+	struct BallMask mask;
+	int n;
 
-			if (matchComb) noMatch = !findComb(drawnBallsNorm, matchComb);
-			else noMatch = 0;
+	appendDraw(ph, keys, bonusBall, date);
 
-			if (elimComb) noElim = findComb(drawnBallsNorm, elimComb);
-			else noElim = 0;
+	/* the appended row is moved to the top */
+	n = ph->count - 1;
 
-			if (!(noMatch || noElim)) {
-				if (i < 20) {
-					found = search1BallXY(coupon, drawnBallsNorm, DRAW_BALL);
-				} else if (i < 30) {
-					found = search2CombXY(coupon, drawnBallsNorm);
-				} else if (i < 40) {
-					found = search3CombXY(coupon, drawnBallsNorm);
-				} else {
-					found = search4CombXY(coupon, drawnBallsNorm);
-				}
+	memcpy(balls, ph->balls[n], MAX_DRAW_BALL);
+	mask = ph->mask[n];
 
-				if(!found) break;
-			}
+	memmove(ph->balls[1], ph->balls[0], sizeof(unsigned char)*MAX_DRAW_BALL*n);
+	memmove(ph->mask + 1, ph->mask, sizeof(struct BallMask)*n);
+	memmove(ph->bonusBall + 1, ph->bonusBall, sizeof(unsigned char)*n);
+	memmove(ph->date + 1, ph->date, sizeof(long)*n);
 
-			if (autoCalc) {
-				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
-				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
-				else {matchComb = 0; elimComb = 0;}
-			}
-		}
+	memcpy(ph->balls[0], balls, MAX_DRAW_BALL);
+	ph->mask[0] = mask;
+	ph->bonusBall[0] = (unsigned char) bonusBall;
+	ph->date[0] = date;
+}
 
-		appendList(coupon, drawnBallsNorm);
-		drawCount--;
-	}
 
 
-	/* Blend 1 */
-	if (drawByBlend1 && drawCount) 
-	{
-		strcpy(label, "(blend 1)");
-		drawnBallsBlend1 = createListX(drawnBallsBlend1, NULL, label, 0);
+long packDate(int d, int m, int y)
+{
+	return (long) y*10000 + m*100 + d;
+}
+
 
-		if (autoCalc) {
-			matchComb = 0;
-			elimComb = 2;
-		}
 
-		for (i=0; i<49; i++) 
-		{
-			drawnBallsBlend1 = drawBallByBlend1(drawnBallsBlend1, winningBallStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb);
+void unpackDate(long date, int *d, int *m, int *y)
+{
+	*d = (int) (date % 100);
+	*m = (int) (date / 100 % 100);
+	*y = (int) (date / 10000);
+}
 
-			if (matchComb) noMatch = !findComb(drawnBallsBlend1, matchComb);
-			else noMatch = 0;
 
-			if (elimComb) noElim = findComb(drawnBallsBlend1, elimComb);
-			else noElim = 0;
 
-			if (!(noMatch || noElim)) {
-				if (i < 20) {
-					found = search1BallXY(coupon, drawnBallsBlend1, DRAW_BALL);
-				} else if (i < 30) {
-					found = search2CombXY(coupon, drawnBallsBlend1);
-				} else if (i < 40) {
-					found = search3CombXY(coupon, drawnBallsBlend1);
-				} else {
-					found = search4CombXY(coupon, drawnBallsBlend1);
-				}
+void formatDate(long date, char *str)
+{
+	int d, m, y;
 
-				if(!found) break;
-			}
+	unpackDate(date, &d, &m, &y);
 
-			if (autoCalc) {
-				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
-				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
-				else {matchComb = 0; elimComb = 0;}
-			}
-		}
+	if (game.dateFormat == DATE_MDY) sprintf(str, "%02d/%02d/%d", m, d, y);
+	else sprintf(str, "%02d.%02d.%d", d, m, y);
+}
 
-		appendList(coupon, drawnBallsBlend1);
-		drawCount--;
-	}
 
 
-	/* Blend 2 */
-	if (drawByBlend2 && drawCount) 
-	{
-		strcpy(label, "(blend 2)");
-		drawnBallsBlend2 = createListX(drawnBallsBlend2, NULL, label, 0);
+long dayNumber(long date)
+{
+	int d, m, y;
 
-		if (autoCalc) {
-			matchComb = 0;
-			elimComb = 2;
-		}
+	unpackDate(date, &d, &m, &y);
 
-		for (i=0; i<49; i++) 
-		{
-			drawnBallsBlend2 = drawBallByBlend2(drawnBallsBlend2, winningBallStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb);
+	m = (m + 9) % 12;
+	y = y - m / 10;
 
-			if (matchComb) noMatch = !findComb(drawnBallsBlend2, matchComb);
-			else noMatch = 0;
+	return 365L*y + y/4 - y/100 + y/400 + (m*306 + 5)/10 + (d-1);
+}
 
-			if (elimComb) noElim = findComb(drawnBallsBlend2, elimComb);
-			else noElim = 0;
 
-			if (!(noMatch || noElim)) {
-				if (i < 20) {
-					found = search1BallXY(coupon, drawnBallsBlend2, DRAW_BALL);
-				} else if (i < 30) {
-					found = search2CombXY(coupon, drawnBallsBlend2);
-				} else if (i < 40) {
-					found = search3CombXY(coupon, drawnBallsBlend2);
-				} else {
-					found = search4CombXY(coupon, drawnBallsBlend2);
-				}
 
-				if(!found) break;
-			}
+long dayDate(long day)
+{
+	long y, ddd, mi;
 
-			if (autoCalc) {
-				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
-				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
-				else {matchComb = 0; elimComb = 0;}
-			}
-		}
+	y = (long) ((10000.0*day + 14780) / 3652425);
+	ddd = day - (365*y + y/4 - y/100 + y/400);
 
-		appendList(coupon, drawnBallsBlend2);
-		drawCount--;
+	if (ddd < 0) {
+		y--;
+		ddd = day - (365*y + y/4 - y/100 + y/400);
 	}
 
+	mi = (100*ddd + 52) / 3060;
 
-	/* Left Stacked */
-	if (drawByLeft && drawCount) 
-	{
-		strcpy(label, "(left stacked)");
-		drawnBallsLeft = createListX(drawnBallsLeft, NULL, label, 0);
+	return packDate((int) (ddd - (mi*306 + 5)/10 + 1), (int) ((mi + 2) % 12 + 1), (int) (y + (mi + 2) / 12));
+}
 
-		if (autoCalc) {
-			matchComb = 0;
-			elimComb = 2;
-		}
 
-		for (i=0; i<49; i++) 
-		{
-			drawnBallsLeft = drawBallByLeft(drawnBallsLeft, winningBallStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb);
 
-			if (matchComb) noMatch = !findComb(drawnBallsLeft, matchComb);
-			else noMatch = 0;
+int dateDiff(int d1, int m1, int y1, int d2, int m2, int y2)
+{
+	int x1, x2;
 
-			if (elimComb) noElim = findComb(drawnBallsLeft, elimComb);
-			else noElim = 0;
+	m1 = (m1 + 9) % 12;
+	y1 = y1 - m1 / 10;
+	x1 = 365*y1 + y1/4 - y1/100 + y1/400 + (m1*306 + 5)/10 + (d1-1);
 
-			if (!(noMatch || noElim)) {
-				if (i < 20) {
-					found = search1BallXY(coupon, drawnBallsLeft, DRAW_BALL);
-				} else if (i < 30) {
-					found = search2CombXY(coupon, drawnBallsLeft);
-				} else if (i < 40) {
-					found = search3CombXY(coupon, drawnBallsLeft);
-				} else {
-					found = search4CombXY(coupon, drawnBallsLeft);
-				}
+	m2 = (m2 + 9) % 12;
+	y2 = y2 - m2 / 10;
+	x2 = 365*y2 + y2/4 - y2/100 + y2/400 + (m2*306 + 5)/10 + (d2-1);
 
-				if(!found) break;
-			}
+	return (x2-x1);
+}
 
-			if (autoCalc) {
-				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
-				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
-				else {matchComb = 0; elimComb = 0;}
-			}
-		}
 
-		appendList(coupon, drawnBallsLeft);
-		drawCount--;
-	}
 
+void clearGlobe(struct Globe *pg)
+{
+	pg->count = 0;
+}
 
-	/* Side Stacked */
-	if (drawBySide && drawCount) 
-	{
-		strcpy(label, "(side stacked)");
-		drawnBallsSide = createListX(drawnBallsSide, NULL, label, 0);
 
-		if (autoCalc) {
-			matchComb = 0;
-			elimComb = 2;
-		}
 
-		for (i=0; i<49; i++) 
-		{
-			drawnBallsSide = drawBallBySide(drawnBallsSide, winningBallStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb);
+void insertGlobe(struct Globe *pg, int key)
+{
+	memmove(pg->balls + 1, pg->balls, pg->count * sizeof(int));
+	pg->balls[0] = key;
+	pg->count++;
+}
 
-			if (matchComb) noMatch = !findComb(drawnBallsSide, matchComb);
-			else noMatch = 0;
 
-			if (elimComb) noElim = findComb(drawnBallsSide, elimComb);
-			else noElim = 0;
 
-			if (!(noMatch || noElim)) {
-				if (i < 20) {
-					found = search1BallXY(coupon, drawnBallsSide, DRAW_BALL);
-				} else if (i < 30) {
-					found = search2CombXY(coupon, drawnBallsSide);
-				} else if (i < 40) {
-					found = search3CombXY(coupon, drawnBallsSide);
-				} else {
-					found = search4CombXY(coupon, drawnBallsSide);
-				}
+void appendGlobe(struct Globe *pg, int key)
+{
+	pg->balls[pg->count++] = key;
+}
 
-				if(!found) break;
-			}
 
-			if (autoCalc) {
-				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
-				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
-				else {matchComb = 0; elimComb = 0;}
-			}
-		}
 
-		appendList(coupon, drawnBallsSide);
-		drawCount--;
+int addGlobeByIndex(struct Globe *pg, int ind, int key)
+{
+	int i;
+
+	for (i=0; i<pg->count; i++) {
+		if (pg->balls[i] == key) return 0;
 	}
 
+	if (pg->count == 0) ind = 0;
+	else if (ind > pg->count) return 0;
 
-	/* Random */
-	if (drawByRand && drawCount) 
-	{
-		strcpy(label, "(random)");
-		drawnBallsRand = createListX(drawnBallsRand, NULL, label, 0);
+	memmove(pg->balls + ind + 1, pg->balls + ind, (pg->count - ind) * sizeof(int));
+	pg->balls[ind] = key;
+	pg->count++;
 
-		if (autoCalc) {
-			matchComb = 0;
-			elimComb = 2;
-		}
+	return 1;
+}
 
-		for (i=0; i<49; i++) 
-		{
-			drawnBallsRand = drawBallByRand(drawnBallsRand, winningBallStats, TOTAL_BALL, DRAW_BALL, matchComb, elimComb);
 
-			if (matchComb) noMatch = !findComb(drawnBallsRand, matchComb);
-			else noMatch = 0;
 
-			if (elimComb) noElim = findComb(drawnBallsRand, elimComb);
-			else noElim = 0;
+int removeGlobeByIndex(struct Globe *pg, int ind)
+{
+	int key;
 
-			if (!(noMatch || noElim)) {
-				if (i < 20) {
-					found = search1BallXY(coupon, drawnBallsRand, DRAW_BALL);
-				} else if (i < 30) {
-					found = search2CombXY(coupon, drawnBallsRand);
-				} else if (i < 40) {
-					found = search3CombXY(coupon, drawnBallsRand);
-				} else {
-					found = search4CombXY(coupon, drawnBallsRand);
-				}
+	if (ind < 0 || ind >= pg->count) return 0;
 
-				if(!found) break;
-			}
+	key = pg->balls[ind];
+	pg->count--;
+	memmove(pg->balls + ind, pg->balls + ind + 1, (pg->count - ind) * sizeof(int));
 
-			if (autoCalc) {
-				if (i > 19 && i <= 29) {matchComb = 0; elimComb = 3;}
-				else if (i > 29 && i <= 39) {matchComb = 3; elimComb = 4;}
-				else {matchComb = 0; elimComb = 0;}
-			}
-		}
+	return key;
+}
 
-		appendList(coupon, drawnBallsRand);
-		drawCount--;
-	}
 
 
-	/* Lucky */
-	if (drawByLucky && drawCount) 
-	{
-		drawBallsByLucky(coupon, (rand()%3)+1, totalDrawCount);
-		drawCount--;
-	}
+void moveBallToLeft(struct Globe *pg, int ind)
+{
+	int key = pg->balls[ind];
 
-	if (drawCount) goto startDraw;
+	memmove(pg->balls + 1, pg->balls, ind * sizeof(int));
+	pg->balls[0] = key;
 }
 
 
 
-void drawSuperStar(struct ListXY *coupon, int drawCount)
+void moveBallToRight(struct Globe *pg, int ind)
 {
-	int i, j;
-	int found = 0;
-	char label[30];
+	int key = pg->balls[ind];
 
-	struct ListX *drawnBalls = NULL;
+	memmove(pg->balls + ind, pg->balls + ind + 1, (pg->count - ind - 1) * sizeof(int));
+	pg->balls[pg->count - 1] = key;
+}
 
-	strcpy(label, "super star");
 
-	for (i=0; i<drawCount; i++) 
+
+void mixGlobe(struct Globe *pg, int totalBall, unsigned int moves, struct Rng *rng)
+{
+	unsigned int index[SHUFFLE_BATCH];
+	int middle = (int) ceil(totalBall/2);
+	int i, n, ind;
+
+	if (rng->type != RNG_LIBC && moves >= (unsigned int) (pg->count * pg->count))
 	{
-		drawnBalls = createListX(drawnBalls, NULL, label, 0);
+		shuffleBalls(pg->balls, (pg->count < middle-1) ? pg->count : middle-1, rng);
+		if (pg->count > middle+1) shuffleBalls(pg->balls + middle+1, pg->count - middle-1, rng);
 
-		for (j=0; j<6; j++) 
-		{
-			drawnBalls = drawBallByNorm(drawnBalls, superStarBallStats, TOTAL_BALL_SS, 1, 0, 0);
-			found = search1BallXY(coupon, drawnBalls, 1);
-			if(!found) break;
-		}
+		return;
+	}
 
-		if (found) {
-			for (j=0; j<6; j++) 
-			{
-				drawnBalls = drawBallByRand(drawnBalls, superStarBallStats, TOTAL_BALL_SS, 1, 0, 0);
-				found = search1BallXY(coupon, drawnBalls, 1);
-				if(!found) break;
-			}
-		}
+	while (moves > 0)
+	{
+		n = (moves < SHUFFLE_BATCH) ? moves : SHUFFLE_BATCH;
 
-		if (found) {
-			for (j=0; j<6; j++) 
-			{
-				drawnBalls = drawBallByBlend1(drawnBalls, superStarBallStats, TOTAL_BALL_SS, 1, 0, 0);
-				found = search1BallXY(coupon, drawnBalls, 1);
-				if(!found) break;
-			}
+		for (i=0; i<n; i++) {
+			index[i] = nextRng(rng);
 		}
 
-		if (found) {
-			for (j=0; j<6; j++) 
-			{
-				drawnBalls = drawBallByBlend2(drawnBalls, superStarBallStats, TOTAL_BALL_SS, 1, 0, 0);
-				found = search1BallXY(coupon, drawnBalls, 1);
-				if(!found) break;
-			}
+		for (i=0; i<n; i++) {
+			index[i] %= (unsigned int) pg->count;
 		}
 
-		if (found) {
-			for (j=0; j<6; j++) 
-			{
-				drawnBalls = drawBallByNorm(drawnBalls, superStarBallStats, TOTAL_BALL_SS, 1, 0, 0);
-				found = search1BallXY(coupon, drawnBalls, 1);
-				if(!found) break;
-			}
+		for (i=0; i<n; i++)
+		{
+			ind = (int) index[i];
+
+			if (ind == middle-1 || ind == middle)
+				continue;
+			else if (ind < middle-1)
+				moveBallToLeft(pg, ind);
+			else
+				moveBallToRight(pg, ind);
 		}
 
-		appendList(coupon, drawnBalls);
+		moves -= n;
 	}
 }
 
 
 
-void getDrawnBallsList(struct ListXY * winningDrawnBallsList, struct ListXY * superStarDrawnBallsList, char *fileName)
+void shuffleBalls(int *balls, int count, struct Rng *rng)
 {
-	int i;
-	int d1, m1, y1, joker, sstar;
-	int n1, n2, n3, n4, n5, n6;
-	int keys[DRAW_BALL+1];
-
-	int eof = 0;
-	FILE *fp;
-
-	struct ListX *drawList = NULL;
-	char s1[3], s2[3], s3[5];
-	char tmp[2];
-	char date[11];
-
-	if ((fp = fopen(fileName, "r")) == NULL) {
-		printf("%s file not found!\n", fileName);
-		return;
-	}
+	int i, ind, key;
 
-	for (i=0; eof != EOF; i++)
+	for (i=count-1; i>0; i--) 
 	{
-		#ifdef SAYISALLOTTO
-			eof = fscanf(fp, "%d.%d.%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", &d1, &m1, &y1, &n1, &n2, &n3, &n4, &n5, &n6, &joker, &sstar);
-		#else
-			eof = fscanf(fp, "%d.%d.%d\t%d\t%d\t%d\t%d\t%d\t%d\n", &d1, &m1, &y1, &n1, &n2, &n3, &n4, &n5, &n6);
-		#endif
+		ind = randRng(rng, i+1);
+		key = balls[i];
+		balls[i] = balls[ind];
+		balls[ind] = key;
+	}
+}
 
-		if (eof == EOF) break;
 
-		sprintf(s1, "%d", d1);
-		sprintf(s2, "%d", m1);
-		sprintf(s3, "%d", y1);
 
-		date[0] = '\0';
+void drawGlobeBalls(struct Globe *pg, struct ListX *drawnBalls, int drawBall, struct Rng *rng)
+{
+	double weight[MAX_TOTAL_BALL];
+	double total = 0, u;
+	int ballCount = pg->count;
+	int i, k, last;
+	unsigned int drawball;
 
-		if (strlen(s1)==1) {
-			tmp[0] = s1[0];
-			s1[0] = '0';
-			s1[1] = tmp[0];
-			s1[2] = '\0';
-		}
-		if (strlen(s2)==1) {
-			tmp[0] = s2[0];
-			s2[0] = '0';
-			s2[1] = tmp[0];
-			s2[2] = '\0';
+	if (rng->type == RNG_LIBC)
+	{
+		for (i=0; i<drawBall; i++)
+		{
+			drawball = pg->balls[gaussIndex(ballCount, rng)-1];
+			if (seqSearchX1(drawnBalls, drawball) >= 0) {
+				do {
+					drawball = pg->balls[gaussIndex(ballCount, rng)-1];
+				} while(seqSearchX1(drawnBalls, drawball) >= 0);
+			}
+			appendItem(drawnBalls, drawball);
 		}
+		return;
+	}
 
-		sprintf(date, "%s.%s.%s", s1, s2, s3);
+	for (k=0; k<ballCount; k++) {
+		weight[k] = gaussTable[ballCount].weight[k];
+		total += weight[k];
+	}
 
-		drawList = createListX(drawList, date, NULL, 0);
+	for (i=0; i<drawBall && i<ballCount; i++)
+	{
+		u = nextRng(rng) / 4294967296.0 * total;
 
-		keys[0] = n1;
-		keys[1] = n2;
-		keys[2] = n3;
-		keys[3] = n4;
-		keys[4] = n5;
-		keys[5] = n6;
-		keys[6] = '\0';
-		
-		appendItems(drawList, keys);
+		for (k=0, last=-1; k<ballCount; k++) 
+		{
+			if (weight[k] > 0) {
+				if (u < weight[k]) break;
+				u -= weight[k];
+				last = k;
+			}
+		}
 
-		appendList(winningDrawnBallsList, drawList);
+		if (k == ballCount) k = last;
 
-		#ifdef SAYISALLOTTO
-			drawList = createListX(drawList, date, NULL, 0);
-			appendItem(drawList, sstar);
-			appendList(superStarDrawnBallsList, drawList);
-		#endif
+		appendItem(drawnBalls, pg->balls[k]);
+		total -= weight[k];
+		weight[k] = 0;
 	}
-
-	fclose(fp);
 }
 
 
 
-int dateDiff(int d1, int m1, int y1, int d2, int m2, int y2)
+void fillGlobe(struct Globe *pg, struct ListX *ballStats, int totalBall, int layout)
 {
-	int x1, x2;
+	int i, j, k;
+	int keys[MAX_TOTAL_BALL+1];
 
-	m1 = (m1 + 9) % 12;
-	y1 = y1 - m1 / 10;
-	x1 = 365*y1 + y1/4 - y1/100 + y1/400 + (m1*306 + 5)/10 + (d1-1);
+	getKeys(ballStats, keys, 0, totalBall);
 
-	m2 = (m2 + 9) % 12;
-	y2 = y2 - m2 / 10;
-	x2 = 365*y2 + y2/4 - y2/100 + y2/400 + (m2*306 + 5)/10 + (d2-1);
+	clearGlobe(pg);
 
-	return (x2-x1);
+	for (i=0, j=totalBall-1, k=0; k<totalBall; k++)
+	{
+		if (layout == GLOBE_LEFT) {
+			appendGlobe(pg, keys[k]);
+		}
+		else if (layout == GLOBE_SIDE) {
+			if (k%2) insertGlobe(pg, keys[k]);
+			else appendGlobe(pg, keys[k]);
+		}
+		else if (k%2) {
+			if (layout == GLOBE_BLEND1) appendGlobe(pg, keys[j]);
+			else addGlobeByIndex(pg, totalBall-j, keys[j]);
+			j--;
+		}
+		else {
+			if (layout == GLOBE_BLEND1) insertGlobe(pg, keys[i]);
+			else addGlobeByIndex(pg, i, keys[i]);
+			i++;
+		}
+	}
 }
 
 
 
-void drawBallByDate(struct ListX *drawnBallsDate1, struct ListX *drawnBallsDate2, struct ListX *ballStats)
+void drawBallByDate(struct ListX *drawnBallsDate1, struct ListX *drawnBallsDate2, struct ListX *ballStats, struct Rng *rng)
 {
-	int x, j, k;
 	int d1=12, m1=7, y1=2021;
 	int d2, m2, y2;
 	time_t rawtime;
 	struct tm *timeInfo;
+#ifdef USE_THREADS
+	struct tm timeBuf;
+#endif
 	unsigned long num;
-	char snum[9], snum2[9], snum3[9], snum4[13];
+	char snum[9], snum2[9], snum3[9], snum4[2*MAX_DRAW_BALL+1];
 	char s1[3], s2[3], s3[3], s4[3];
 	char s5[3], s6[3], s7[3], s8[3];
-	int n1, n2, n3, n4, n5, n6;
-	int e1, e2, e3, e4, e5, e6;
-	char se1[3], se2[3], se3[3], se4[3], se5[3], se6[3];
-	char tmp[1], tmp2[3];
+	int pairs[MAX_DRAW_BALL];
+	int n[MAX_DRAW_BALL];
+	int e[MAX_DRAW_BALL];
+	char se[3];
+	int i, k, len;
+	char tmp2[3];
 	char label[30];
 
 	unsigned int drawball;
 
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, 1);
 
 	/* Fill inside the globe with balls */
-	if (rand() % 2) // (blend1)
-	{ 
-		for (x=0, j=TOTAL_BALL-1, k=0; k<TOTAL_BALL; k++)
-		{
-			if (k%2) {
-				appendItem(globe, getKey(ballStats, j));
-				j--;
-			}
-			else {
-				insertItem(globe, getKey(ballStats, x));
-				x++;
-			}
-		}
-	}
-	else // (blend2)
-	{ 
-		for (x=0, j=TOTAL_BALL-1, k=0; k<TOTAL_BALL; k++)
-		{
-			if (k%2) {
-				addItemByIndex(globe, TOTAL_BALL-j, getKey(ballStats, j));
-				j--;
-			}
-			else {
-				addItemByIndex(globe, x, getKey(ballStats, x));
-				x++;
-			}
-		}
-	}
+	fillGlobe(&globe, ballStats, TOTAL_BALL, randRng(rng, 2) ? GLOBE_BLEND1 : GLOBE_BLEND2);
 
 
 	time(&rawtime);
+
+#ifdef USE_THREADS
+	timeInfo = localtime_r(&rawtime, &timeBuf);
+#else
 	timeInfo = localtime(&rawtime);
+#endif
 
 	d2 = timeInfo->tm_mday;
 	m2 = timeInfo->tm_mon +1;
@@ -4650,251 +7058,87 @@ void drawBallByDate(struct ListX *drawnBallsDate1, struct ListX *drawnBallsDate2
 	s8[1] = snum3[7];
 	s8[2] = '\0';
 
-	n1 = (atoi(s2)+atoi(s5)) % TOTAL_BALL;
-	if (n1 == 0) n1 = TOTAL_BALL;
-	n2 = (atoi(s1)+atoi(s6)) % TOTAL_BALL;
-	if (n2 == 0) n2 = TOTAL_BALL;
-	n3 = (atoi(s3)+atoi(s6)) % TOTAL_BALL;
-	if (n3 == 0) n3 = TOTAL_BALL;
-	n4 = (atoi(s2)+atoi(s7)) % TOTAL_BALL;
-	if (n4 == 0) n4 = TOTAL_BALL;
-	n5 = (atoi(s4)+atoi(s7)) % TOTAL_BALL;
-	if (n5 == 0) n5 = TOTAL_BALL;
-	n6 = (atoi(s3)+atoi(s8)) % TOTAL_BALL;
-	if (n6 == 0) n6 = TOTAL_BALL;
-
-	sprintf(se1, "%d", n1);
-	sprintf(se2, "%d", n2);
-	sprintf(se3, "%d", n3);
-	sprintf(se4, "%d", n4);
-	sprintf(se5, "%d", n5);
-	sprintf(se6, "%d", n6);
-
-	snum4[0] = '\0';
-
-	if (strlen(se1)==1) {
-		tmp[0] = se1[0];
-		se1[0] = '0';
-		se1[1] = tmp[0];
-		se1[2] = '\0';
-	}
-	if (strlen(se2)==1) {
-		tmp[0] = se2[0];
-		se2[0] = '0';
-		se2[1] = tmp[0];
-		se2[2] = '\0';
-	}
-	if (strlen(se3)==1) {
-		tmp[0] = se3[0];
-		se3[0] = '0';
-		se3[1] = tmp[0];
-		se3[2] = '\0';
-	}
-	if (strlen(se4)==1) {
-		tmp[0] = se4[0];
-		se4[0] = '0';
-		se4[1] = tmp[0];
-		se4[2] = '\0';
-	}
-	if (strlen(se5)==1) {
-		tmp[0] = se5[0];
-		se5[0] = '0';
-		se5[1] = tmp[0];
-		se5[2] = '\0';
-	}
-	if (strlen(se6)==1) {
-		tmp[0] = se6[0];
-		se6[0] = '0';
-		se6[1] = tmp[0];
-		se6[2] = '\0';
-	}
-
-	strcat(snum4, se1);
-	strcat(snum4, se2);
-	strcat(snum4, se3);
-	strcat(snum4, se4);
-	strcat(snum4, se5);
-	strcat(snum4, se6);
-
-	tmp2[2] = '\0';
-
-	tmp2[0] = snum4[11];
-	tmp2[1] = snum4[0];
-	e1 = atoi(tmp2) % TOTAL_BALL;
-	if (e1 == 0) e1 = TOTAL_BALL;
-
-	tmp2[0] = snum4[1];
-	tmp2[1] = snum4[2];
-	e2 = atoi(tmp2) % TOTAL_BALL;
-	if (e2 == 0) e2 = TOTAL_BALL;
-
-	tmp2[0] = snum4[3];
-	tmp2[1] = snum4[4];
-	e3 = atoi(tmp2) % TOTAL_BALL;
-	if (e3 == 0) e3 = TOTAL_BALL;
-
-	tmp2[0] = snum4[5];
-	tmp2[1] = snum4[6];
-	e4 = atoi(tmp2) % TOTAL_BALL;
-	if (e4 == 0) e4 = TOTAL_BALL;
-
-	tmp2[0] = snum4[7];
-	tmp2[1] = snum4[8];
-	e5 = atoi(tmp2) % TOTAL_BALL;
-	if (e5 == 0) e5 = TOTAL_BALL;
-
-	tmp2[0] = snum4[9];
-	tmp2[1] = snum4[10];
-	e6 = atoi(tmp2) % TOTAL_BALL;
-	if (e6 == 0) e6 = TOTAL_BALL;
-
-	appendItem(drawnBallsDate1, n1);
+	pairs[0] = atoi(s2)+atoi(s5);
+	pairs[1] = atoi(s1)+atoi(s6);
+	pairs[2] = atoi(s3)+atoi(s6);
+	pairs[3] = atoi(s2)+atoi(s7);
+	pairs[4] = atoi(s4)+atoi(s7);
+	pairs[5] = atoi(s3)+atoi(s8);
 
-	if (seqSearchX1(drawnBallsDate1, n2) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate1, drawball) >= 0);
-		n2 = drawball;
-	}
-
-	appendItem(drawnBallsDate1, n2);
+	/* the pairs left over by the games drawing fewer balls are added to every ball */
+	for (i=0; i<DRAW_BALL; i++) 
+	{
+		n[i] = pairs[i];
+		for (k=DRAW_BALL; k<MAX_DRAW_BALL; k++) n[i] += pairs[k];
 
-	if (seqSearchX1(drawnBallsDate1, n3) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate1, drawball) >= 0);
-		n3 = drawball;
+		n[i] %= TOTAL_BALL;
+		if (n[i] == 0) n[i] = TOTAL_BALL;
 	}
 
-	appendItem(drawnBallsDate1, n3);
+	snum4[0] = '\0';
 
-	if (seqSearchX1(drawnBallsDate1, n4) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate1, drawball) >= 0);
-		n4 = drawball;
+	for (i=0; i<DRAW_BALL; i++) {
+		sprintf(se, "%02d", n[i]);
+		strcat(snum4, se);
 	}
 
-	appendItem(drawnBallsDate1, n4);
+	/* the second draw takes the digits of the first draw rotated by one digit */
+	len = 2*DRAW_BALL;
+	tmp2[2] = '\0';
 
-	if (seqSearchX1(drawnBallsDate1, n5) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate1, drawball) >= 0);
-		n5 = drawball;
+	for (i=0; i<DRAW_BALL; i++) 
+	{
+		tmp2[0] = snum4[(2*i + len - 1) % len];
+		tmp2[1] = snum4[2*i];
+		e[i] = atoi(tmp2) % TOTAL_BALL;
+		if (e[i] == 0) e[i] = TOTAL_BALL;
 	}
 
-	appendItem(drawnBallsDate1, n5);
+	for (i=0; i<DRAW_BALL; i++) 
+	{
+		if (seqSearchX1(drawnBallsDate1, n[i]) >= 0) {
+			do {
+				drawball = globe.balls[gaussIndex(TOTAL_BALL, rng)-1];
+			} while(seqSearchX1(drawnBallsDate1, drawball) >= 0);
+			n[i] = drawball;
+		}
 
-	if (seqSearchX1(drawnBallsDate1, n6) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate1, drawball) >= 0);
-		n6 = drawball;
+		appendItem(drawnBallsDate1, n[i]);
 	}
 
-	appendItem(drawnBallsDate1, n6);
-
 	bubbleSortXByKey(drawnBallsDate1);
 
-	appendItem(drawnBallsDate2, e1);
-
-	if (seqSearchX1(drawnBallsDate2, e2) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate2, drawball) >= 0);
-		e2 = drawball;
-	}
-
-	appendItem(drawnBallsDate2, e2);
-
-	if (seqSearchX1(drawnBallsDate2, e3) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate2, drawball) >= 0);
-		e3 = drawball;
-	}
-
-	appendItem(drawnBallsDate2, e3);
-
-	if (seqSearchX1(drawnBallsDate2, e4) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate2, drawball) >= 0);
-		e4 = drawball;
-	}
-
-	appendItem(drawnBallsDate2, e4);
-
-	if (seqSearchX1(drawnBallsDate2, e5) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate2, drawball) >= 0);
-		e5 = drawball;
-	}
-
-	appendItem(drawnBallsDate2, e5);
+	for (i=0; i<DRAW_BALL; i++) 
+	{
+		if (seqSearchX1(drawnBallsDate2, e[i]) >= 0) {
+			do {
+				drawball = globe.balls[gaussIndex(TOTAL_BALL, rng)-1];
+			} while(seqSearchX1(drawnBallsDate2, drawball) >= 0);
+			e[i] = drawball;
+		}
 
-	if (seqSearchX1(drawnBallsDate2, e6) >= 0) {
-		do {
-			drawball = getKey(globe, gaussIndex(TOTAL_BALL)-1);
-		} while(seqSearchX1(drawnBallsDate2, drawball) >= 0);
-		e6 = drawball;
+		appendItem(drawnBallsDate2, e[i]);
 	}
 
-	appendItem(drawnBallsDate2, e6);
-
 	bubbleSortXByKey(drawnBallsDate2);
 
-	removeAllX(globe);
-	free(globe);
 }
 
 
 
-struct ListX * drawBallByRand(struct ListX *drawnBallsRand, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb)
+struct ListX * drawBallByRand(struct ListX *drawnBallsRand, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng)
 {
-	int i, j, k, x, y, z;
-	int index;
-	unsigned int flyball, drawball;
+	int i, j, x, y, z;
+	unsigned int drawball;
 	unsigned int shuffleGlobe;
 	int noMatch, noElim;
 
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, 1);
 
 	/* Fill inside the globe with balls */
-	if (rand() % 2) // (blend1)
-	{ 
-		for (x=0, j=totalBall-1, k=0; k<totalBall; k++)
-		{
-			if (k%2) {
-				appendItem(globe, getKey(ballStats, j));
-				j--;
-			}
-			else {
-				insertItem(globe, getKey(ballStats, x));
-				x++;
-			}
-		}
-	}
-	else // (blend2)
-	{ 
-		for (x=0, j=totalBall-1, k=0; k<totalBall; k++)
-		{
-			if (k%2) {
-				addItemByIndex(globe, totalBall-j, getKey(ballStats, j));
-				j--;
-			}
-			else {
-				addItemByIndex(globe, x, getKey(ballStats, x));
-				x++;
-			}
-		}
-	}
+	fillGlobe(&globe, ballStats, totalBall, randRng(rng, 2) ? GLOBE_BLEND1 : GLOBE_BLEND2);
 
 	for (i=0; i < drawBall*3; i++)
 	{
@@ -4903,37 +7147,22 @@ struct ListX * drawBallByRand(struct ListX *drawnBallsRand, struct ListX *ballSt
 		for (j=0; j<drawBall; j++)
 		{
 			/* shuffle globe */
-			shuffleGlobe = (int) ceil((totalBall * totalBall * totalBall * (rand()%3+1)) / ceil(totalBall/3));
-
-			for (k=0; k<shuffleGlobe; k++)
-			{
-				index = rand() % (totalBall-j);
-
-				if (index == (int) ceil(totalBall/2) -1 || index == (int) ceil(totalBall/2))
-					continue;
-				else if (index < (int) ceil(totalBall/2)-1) {
-					flyball = removeItemByIndex(globe, index);
-					insertItem(globe, flyball);
-				}
-				else {
-					flyball = removeItemByIndex(globe, index);
-					appendItem(globe, flyball);
-				}
-			}
+			shuffleGlobe = (int) ceil((totalBall * totalBall * totalBall * (randRng(rng, 3)+1)) / ceil(totalBall/3));
+			mixGlobe(&globe, totalBall, shuffleGlobe, rng);
 
 			/* draw a ball */
-			drawball = removeItemByIndex(globe, (int) ceil((totalBall-j)/2));
+			drawball = removeGlobeByIndex(&globe, (int) ceil((totalBall-j)/2));
 			appendItem(drawnBallsRand, drawball);
 		}
 
 		for (x=0, y=drawBall-1, z=0; z<drawBall; z++) 
 		{
 			if (z%2) {
-				appendItem(globe, getKey(drawnBallsRand, y));
+				appendGlobe(&globe, getKey(drawnBallsRand, y));
 				y--;
 			}
 			else {
-				insertItem(globe, getKey(drawnBallsRand, x));
+				insertGlobe(&globe, getKey(drawnBallsRand, x));
 				x++;
 			}
 		}
@@ -4953,43 +7182,27 @@ struct ListX * drawBallByRand(struct ListX *drawnBallsRand, struct ListX *ballSt
 	}
 
 	bubbleSortXByKey(drawnBallsRand);
-	removeAllX(globe);
-	free(globe);
 
 	return drawnBallsRand;
 }
 
 
 
-struct ListX * drawBallByLeft(struct ListX *drawnBallsLeft, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb)
+struct ListX * drawBallByLeft(struct ListX *drawnBallsLeft, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng)
 {
-	int i, k;
+	int k;
 	int noMatch, noElim;
-	unsigned int drawball;
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, 1);
 
-	for (i=0; i<totalBall; i++)	{
-		appendItem(globe, getKey(ballStats, i));
-	}
+	fillGlobe(&globe, ballStats, totalBall, GLOBE_LEFT);
 
 	for (k=0; k<totalBall; k++)
 	{
 		removeAllX(drawnBallsLeft);
 
-		for (i=0; i<drawBall; i++)
-		{
-			drawball = getKey(globe, gaussIndex(totalBall)-1);
-			if (seqSearchX1(drawnBallsLeft, drawball) >= 0) {
-				do {
-					drawball = getKey(globe, gaussIndex(totalBall)-1);
-				} while(seqSearchX1(drawnBallsLeft, drawball) >= 0);
-			}
-			appendItem(drawnBallsLeft, drawball);
-		}
+		drawGlobeBalls(&globe, drawnBallsLeft, drawBall, rng);
 
 		noMatch = 0;
 		if (matchComb) {
@@ -5006,51 +7219,27 @@ struct ListX * drawBallByLeft(struct ListX *drawnBallsLeft, struct ListX *ballSt
 	}
 
 	bubbleSortXByKey(drawnBallsLeft);
-	removeAllX(globe);
-	free(globe);
 
 	return drawnBallsLeft;
 }
 
 
 
-struct ListX * drawBallByBlend1(struct ListX *drawnBallsBlend1, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb)
+struct ListX * drawBallByBlend1(struct ListX *drawnBallsBlend1, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng)
 {
-	int i, j, k;
+	int k;
 	int noMatch, noElim;
-	unsigned int drawball;
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, 1);
 
-	for (i=0, j=totalBall-1, k=0; k<totalBall; k++)
-	{
-		if (k%2) {
-			appendItem(globe, getKey(ballStats, j));
-			j--;
-		}
-		else {
-			insertItem(globe, getKey(ballStats, i));
-			i++;
-		}
-	}
+	fillGlobe(&globe, ballStats, totalBall, GLOBE_BLEND1);
 
 	for (k=0; k<totalBall; k++)
 	{
 		removeAllX(drawnBallsBlend1);
 
-		for (i=0; i<drawBall; i++)
-		{
-			drawball = getKey(globe, gaussIndex(totalBall)-1);
-			if (seqSearchX1(drawnBallsBlend1, drawball) >= 0) {
-				do {
-					drawball = getKey(globe, gaussIndex(totalBall)-1);
-				} while(seqSearchX1(drawnBallsBlend1, drawball) >= 0);
-			}
-			appendItem(drawnBallsBlend1, drawball);
-		}
+		drawGlobeBalls(&globe, drawnBallsBlend1, drawBall, rng);
 
 		noMatch = 0;
 		if (matchComb) {
@@ -5067,51 +7256,27 @@ struct ListX * drawBallByBlend1(struct ListX *drawnBallsBlend1, struct ListX *ba
 	}
 
 	bubbleSortXByKey(drawnBallsBlend1);
-	removeAllX(globe);
-	free(globe);
 
 	return drawnBallsBlend1;
 }
 
 
 
-struct ListX * drawBallByBlend2(struct ListX *drawnBallsBlend2, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb)
+struct ListX * drawBallByBlend2(struct ListX *drawnBallsBlend2, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng)
 {
-	int i, j, k;
+	int k;
 	int noMatch, noElim;
-	unsigned int drawball;
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, 1);
 
-	for (i=0, j=totalBall-1, k=0; k<totalBall; k++)
-	{
-		if (k%2) {
-			addItemByIndex(globe, totalBall-j, getKey(ballStats, j));
-			j--;
-		}
-		else {
-			addItemByIndex(globe, i, getKey(ballStats, i));
-			i++;
-		}
-	}
+	fillGlobe(&globe, ballStats, totalBall, GLOBE_BLEND2);
 
 	for (k=0; k<totalBall; k++)
 	{
 		removeAllX(drawnBallsBlend2);
 
-		for (i=0; i<drawBall; i++)
-		{
-			drawball = getKey(globe, gaussIndex(totalBall)-1);
-			if (seqSearchX1(drawnBallsBlend2, drawball) >= 0) {
-				do {
-					drawball = getKey(globe, gaussIndex(totalBall)-1);
-				} while(seqSearchX1(drawnBallsBlend2, drawball) >= 0);
-			}
-			appendItem(drawnBallsBlend2, drawball);
-		}
+		drawGlobeBalls(&globe, drawnBallsBlend2, drawBall, rng);
 
 		noMatch = 0;
 		if (matchComb) {
@@ -5128,49 +7293,27 @@ struct ListX * drawBallByBlend2(struct ListX *drawnBallsBlend2, struct ListX *ba
 	}
 
 	bubbleSortXByKey(drawnBallsBlend2);
-	removeAllX(globe);
-	free(globe);
 
 	return drawnBallsBlend2;
 }
 
 
 
-struct ListX * drawBallBySide(struct ListX *drawnBallsSide, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb)
+struct ListX * drawBallBySide(struct ListX *drawnBallsSide, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng)
 {
-	int i, k;
+	int k;
 	int noMatch, noElim;
-	unsigned int drawball;
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, 1);
 
-	for (k=0; k<totalBall; k++)
-	{
-		if (k%2) {
-			insertItem(globe, getKey(ballStats, k));
-		}
-		else {
-			appendItem(globe, getKey(ballStats, k));
-		}
-	}
+	fillGlobe(&globe, ballStats, totalBall, GLOBE_SIDE);
 
 	for (k=0; k<totalBall; k++)
 	{
 		removeAllX(drawnBallsSide);
 
-		for (i=0; i<drawBall; i++)
-		{
-			drawball = getKey(globe, gaussIndex(totalBall)-1);
-			if (seqSearchX1(drawnBallsSide, drawball) >= 0) {
-				do {
-					drawball = getKey(globe, gaussIndex(totalBall)-1);
-				} while(seqSearchX1(drawnBallsSide, drawball) >= 0);
-			}
-			appendItem(drawnBallsSide, drawball);
-		}
+		drawGlobeBalls(&globe, drawnBallsSide, drawBall, rng);
 
 		noMatch = 0;
 		if (matchComb) {
@@ -5187,49 +7330,27 @@ struct ListX * drawBallBySide(struct ListX *drawnBallsSide, struct ListX *ballSt
 	}
 
 	bubbleSortXByKey(drawnBallsSide);
-	removeAllX(globe);
-	free(globe);
 
 	return drawnBallsSide;
 }
 
 
 
-struct ListX * drawBallByNorm(struct ListX *drawnBallsNorm, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb)
+struct ListX * drawBallByNorm(struct ListX *drawnBallsNorm, struct ListX *ballStats, int totalBall, int drawBall, int matchComb, int elimComb, struct Rng *rng)
 {
-	int i, k;
+	int k;
 	int noMatch, noElim;
-	unsigned int drawball;
-	struct ListX *globe = NULL;
-
-	globe = createListX(globe, NULL, NULL, 0);
+	struct Globe globe;
 
 	bubbleSortXByVal(ballStats, -1);
 
-	for (k=0; k<totalBall; k++)
-	{
-		if (k%2) {
-			insertItem(globe, getKey(ballStats, k));
-		}
-		else {
-			appendItem(globe, getKey(ballStats, k));
-		}
-	}
+	fillGlobe(&globe, ballStats, totalBall, GLOBE_SIDE);
 
 	for (k=0; k<totalBall; k++)
 	{
 		removeAllX(drawnBallsNorm);
 
-		for (i=0; i<drawBall; i++)
-		{
-			drawball = getKey(globe, gaussIndex(totalBall)-1);
-			if (seqSearchX1(drawnBallsNorm, drawball) >= 0) {
-				do {
-					drawball = getKey(globe, gaussIndex(totalBall)-1);
-				} while(seqSearchX1(drawnBallsNorm, drawball) >= 0);
-			}
-			appendItem(drawnBallsNorm, drawball);
-		}
+		drawGlobeBalls(&globe, drawnBallsNorm, drawBall, rng);
 
 		noMatch = 0;
 		if (matchComb) {
@@ -5246,66 +7367,47 @@ struct ListX * drawBallByNorm(struct ListX *drawnBallsNorm, struct ListX *ballSt
 	}
 
 	bubbleSortXByKey(drawnBallsNorm);
-	removeAllX(globe);
-	free(globe);
 
 	return drawnBallsNorm;
 }
 
 
 
-void getDrawnBallsStats(struct ListXY *winningDrawnBallsList, struct ListXY *superStarDrawnBallsList, struct ListX *winningBallStats, struct ListX *superStarBallStats)
+void getDrawnBallsStats(struct DrawHistory *history, struct ListX *winningBallStats, struct ListX *bonusBallStats)
 {
-	int i;
-	int n1, n2, n3, n4, n5, n6;
-	int keys[DRAW_BALL+1];
-	int superStar;
-	int index;
-
-	struct ListX *aPrvDrawn = NULL;
+	int i, j;
+	int counts[MAX_TOTAL_BALL+1];
+	int bonusCounts[MAX_TOTAL_BALL+1];
 
-	for (i=0; i<TOTAL_BALL; i++) {
-		insertItem(winningBallStats, i+1);
-	}
+	struct Item *t;
 
-	for (i=0; i<TOTAL_BALL; i++) {
-		chgVal(winningBallStats, i, 0);
-	}
+	memset(counts, 0, sizeof(counts));
+	memset(bonusCounts, 0, sizeof(bonusCounts));
 
-	for (i=0; i<lengthY(winningDrawnBallsList); i++) 
+	/* the balls are counted over the packed rows, the bonus ball 0 (not drawn yet) is not in the stats */
+	for (i=0; i<history->count; i++) 
 	{
-		aPrvDrawn = getListXByIndex(winningDrawnBallsList, i);
-
-		getKeys(aPrvDrawn, keys, 0, 6);
+		for (j=0; j<DRAW_BALL; j++) {
+			counts[history->balls[i][j]]++;
+		}
 
-		n1 = keys[0];
-		n2 = keys[1];
-		n3 = keys[2];
-		n4 = keys[3];
-		n5 = keys[4];
-		n6 = keys[5];
+		if (TOTAL_BALL_BONUS) bonusCounts[history->bonusBall[i]]++;
+	}
 
-		if ((index = seqSearchX1(winningBallStats,n1)) != -1) incVal(winningBallStats, index);
-		if ((index = seqSearchX1(winningBallStats,n2)) != -1) incVal(winningBallStats, index);
-		if ((index = seqSearchX1(winningBallStats,n3)) != -1) incVal(winningBallStats, index);
-		if ((index = seqSearchX1(winningBallStats,n4)) != -1) incVal(winningBallStats, index);
-		if ((index = seqSearchX1(winningBallStats,n5)) != -1) incVal(winningBallStats, index);
-		if ((index = seqSearchX1(winningBallStats,n6)) != -1) incVal(winningBallStats, index);
+	for (i=0; i<TOTAL_BALL; i++) {
+		insertItem(winningBallStats, i+1);
 	}
 
-	for (i=0; i<TOTAL_BALL_SS; i++)	{
-		insertItem(superStarBallStats, i+1);
+	for (t = winningBallStats->head; (t); t = t->next) {
+		t->val = counts[t->key];
 	}
 
-	for (i=0; i<TOTAL_BALL_SS; i++) {
-		chgVal(superStarBallStats, i, 0);
+	for (i=0; i<TOTAL_BALL_BONUS; i++) {
+		insertItem(bonusBallStats, i+1);
 	}
 
-	for (i=0; i<lengthY(superStarDrawnBallsList); i++) 
-	{
-		aPrvDrawn = getListXByIndex(superStarDrawnBallsList, i);
-		superStar = getKey(aPrvDrawn, 0);
-		if ((index = seqSearchX1(superStarBallStats,superStar)) != -1) incVal(superStarBallStats, index);
+	for (t = bonusBallStats->head; (t); t = t->next) {
+		t->val = bonusCounts[t->key];
 	}
 }
 
@@ -5406,50 +7508,88 @@ int get_app_path (char *pname, size_t pathsize)
 
 
 
-int main(void)
+int main(int argc, char *argv[])
 {
 	int keyb = 0, keyb2;
 
 	struct ListXY *coupon = NULL;
-	struct ListXY *coupon_ss = NULL;
+	struct ListXY *coupon_bonus = NULL;
 
 	struct ListXY *luckyBalls2 = NULL;
 	struct ListXY *luckyBalls3 = NULL;
 	struct ListXY *luckyBalls4 = NULL;
 
 	FILE *fp;
+	double start, initTime;
+	int drawn;
 
-	srand((unsigned) time(NULL));
+	parseArgs(argc, argv);
 
+	if (selfTest) return testGauss(stdout) ? 0 : 1;
+
+	seedRng(&mainRng, rngType, rngSeed);
+
+	start = getTime();
 	init();
+	initTime = getTime() - start;
 
 	coupon = createListXY(coupon);
-	coupon_ss = createListXY(coupon_ss);
+	coupon_bonus = createListXY(coupon_bonus);
 
 	luckyBalls2 = createListXY(luckyBalls2);
 	luckyBalls3 = createListXY(luckyBalls3);
 	luckyBalls4 = createListXY(luckyBalls4);
 
+	if (batchCount) 
+	{
+		if ((fp = fopen(commandOutput ? commandOutput : outputFile, "w")) == NULL) {
+			fprintf(stderr, "Can't open file %s\n", commandOutput ? commandOutput : OUTPUTFILE);
+			return 1;
+		}
+
+		drawn = drawBatch(batchCount, batchStrategy, batchUnique, fp, commandOutput ? commandOutput : OUTPUTFILE, &mainRng);
+
+		if (useBloom) printBloomStats(combFilter);
+
+		fclose(fp);
+		if (!drawn) return 1;
+
+		goto exitProgram;
+	}
+
+	if (command) 
+	{
+		if (commandOutput == NULL) fp = stdout;
+		else if ((fp = fopen(commandOutput, "w")) == NULL) {
+			fprintf(stderr, "Can't open file %s\n", commandOutput);
+			return 1;
+		}
+
+		start = getTime();
+		runCommand(command, fp, &mainRng);
+
+		/* timings go to stderr, stdout may be the output of the command */
+		if (printTime) fprintf(stderr, "init %.3f seconds, command %.3f seconds\n", initTime, getTime() - start);
+
+		if (fp != stdout) fclose(fp);
+		goto exitProgram;
+	}
+
 mainMenu:
 
 	bubbleSortXByVal(winningBallStats, -1);
-	bubbleSortXByVal(superStarBallStats, -1);
+	bubbleSortXByVal(bonusBallStats, -1);
 
-	#ifdef SAYISALLOTTO
-		printf("Sayisal Lotto 1.0");
-	#else
-		printf("Super Lotto 1.0");
-	#endif
-	printf(" Copyright ibrahim Tipirdamaz (c) 2022\n\n");
+	printf("%s Copyright ibrahim Tipirdamaz (c) 2022\n\n", game.title);
 	printf("Which number drawn how many times? : \n\n");
-	printBallStats(winningBallStats);
+	printBallStats(winningBallStats, NULL);
 	printf("\n\n");
 
-	#ifdef SAYISALLOTTO
-		printf("Number of draws of SuperStar balls : \n\n");
-		printBallStats(superStarBallStats);
+	if (TOTAL_BALL_BONUS) {
+		printf("Number of draws of %s : \n\n", game.bonusName);
+		printBallStats(bonusBallStats, NULL);
 		printf("\n\n");
-	#endif
+	}
 
 	printf("1- Draw Ball\n");
 	printf("2- Matched 2 combinations: %u\n", match2comb);
@@ -5493,17 +7633,20 @@ keybCommand:
 		printf("\n");
 
 		/* coupon, totalDrawCount, date, norm, left, blend1, blend2, side, rand, lucky */
-		drawBalls(coupon, keyb2, 1, 1, 1, 1, 1, 1, 1, 1);
-		
-		#ifdef SAYISALLOTTO
-			drawSuperStar(coupon_ss, keyb2);
-			printListXYWithSSByKey(coupon, coupon_ss, fp);
-			removeAllXY(coupon_ss);
-		#else
+		drawBalls(coupon, winningBallStats, drawArena, keyb2, 1, 1, 1, 1, 1, 1, 1, 1, &mainRng);
+
+		if (TOTAL_BALL_BONUS) {
+			drawBonusBall(coupon_bonus, bonusBallStats, drawArena, keyb2, &mainRng);
+			printListXYWithBonusByKey(coupon, coupon_bonus, fp);
+			removeAllXY(coupon_bonus);
+		} else {
 			printListXYByKey(coupon, fp);
-		#endif
+		}
+
+		if (useBloom) printBloomStats(combFilter);
 
 		removeAllXY(coupon);
+		releaseArena(drawArena);
 
 	} else if (keyb == 2) {
 		printf("Calculation results are writing to %s file...\n", OUTPUTFILE);